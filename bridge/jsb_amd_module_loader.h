@@ -7,6 +7,7 @@ namespace jsb
 {
     // `AMDModuleLoader` follows the fundamental guidelines of the `AsynchronousModuleDefinition`, but not really async.
     // it's currently only used to load the `compiled` editor script bundle.
+    // the bundles are embedded (static) sources, they're compiled only once in the process (see `BootstrapCache`).
     class AMDModuleLoader : public IModuleLoader
     {
     private:
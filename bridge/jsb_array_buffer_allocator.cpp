@@ -0,0 +1,104 @@
+#include "jsb_array_buffer_allocator.h"
+
+namespace jsb
+{
+    ArrayBufferAllocator::~ArrayBufferAllocator()
+    {
+        jsb_notice(stats_.outstanding_bytes == 0, "array buffers leaked (%d bytes)", stats_.outstanding_bytes);
+        trim();
+    }
+
+    void* ArrayBufferAllocator::allocate(size_t p_length)
+    {
+        const int class_index = get_class_index(p_length);
+        if (class_index < 0)
+        {
+            lock_.lock();
+            stats_.outstanding_bytes += p_length;
+            lock_.unlock();
+            return memalloc(p_length);
+        }
+
+        lock_.lock();
+        stats_.outstanding_bytes += p_length;
+        if (FreeBlock* block = free_lists_[class_index])
+        {
+            free_lists_[class_index] = block->next;
+            stats_.pooled_bytes -= kMinClassSize << class_index;
+            ++stats_.pool_hits;
+            lock_.unlock();
+            return block;
+        }
+        ++stats_.pool_misses;
+        lock_.unlock();
+        return memalloc(kMinClassSize << class_index);
+    }
+
+    void ArrayBufferAllocator::Free(void* data, size_t length)
+    {
+        if (!data) return;
+
+        const int class_index = get_class_index(length);
+        lock_.lock();
+        jsb_check(stats_.outstanding_bytes >= length);
+        stats_.outstanding_bytes -= length;
+        if (class_index >= 0)
+        {
+            const size_t class_size = kMinClassSize << class_index;
+            if (stats_.pooled_bytes + class_size <= pool_limit_)
+            {
+                FreeBlock* block = (FreeBlock*) data;
+                block->next = free_lists_[class_index];
+                free_lists_[class_index] = block;
+                stats_.pooled_bytes += class_size;
+                lock_.unlock();
+                return;
+            }
+        }
+        lock_.unlock();
+        memfree(data);
+    }
+
+    void ArrayBufferAllocator::set_pool_limit(size_t p_pool_limit)
+    {
+        lock_.lock();
+        pool_limit_ = p_pool_limit;
+        lock_.unlock();
+        trim_to(p_pool_limit);
+    }
+
+    void ArrayBufferAllocator::trim_to(size_t p_pooled_bytes)
+    {
+        // release the larger blocks first
+        FreeBlock* released = nullptr;
+        lock_.lock();
+        for (int class_index = kClassNum - 1; class_index >= 0 && stats_.pooled_bytes > p_pooled_bytes; --class_index)
+        {
+            const size_t class_size = kMinClassSize << class_index;
+            while (FreeBlock* block = free_lists_[class_index])
+            {
+                if (stats_.pooled_bytes <= p_pooled_bytes) break;
+                free_lists_[class_index] = block->next;
+                stats_.pooled_bytes -= class_size;
+                block->next = released;
+                released = block;
+            }
+        }
+        lock_.unlock();
+
+        while (released)
+        {
+            FreeBlock* next = released->next;
+            memfree(released);
+            released = next;
+        }
+    }
+
+    ArrayBufferAllocator::Stats ArrayBufferAllocator::get_stats() const
+    {
+        lock_.lock();
+        const Stats stats = stats_;
+        lock_.unlock();
+        return stats;
+    }
+}
@@ -5,25 +5,88 @@
 
 namespace jsb
 {
+    // ArrayBuffer allocator of an Environment.
+    // Small buffers (up to `kMaxClassSize`) are rounded up to power-of-2 size classes, and recycled in per-class free lists
+    // (capped by `pool_limit` bytes in total). Larger buffers go straight to memalloc/memfree.
+    // Memory is only zeroed on `Allocate` (for the requested length), never on `Free` or `AllocateUninitialized`.
     class ArrayBufferAllocator : public v8::ArrayBuffer::Allocator
     {
     public:
+        static constexpr size_t kMinClassSize = 64;
+        static constexpr size_t kMaxClassSize = 64 * 1024;
+        static constexpr int kMinClassShift = 6;
+        static constexpr int kClassNum = 11;
+
+        static_assert(((size_t) 1 << kMinClassShift) == kMinClassSize);
+        static_assert((kMinClassSize << (kClassNum - 1)) == kMaxClassSize);
+
+        struct Stats
+        {
+            // bytes cached in the free lists
+            uint64_t pooled_bytes = 0;
+
+            // bytes allocated and not freed yet (requested length)
+            uint64_t outstanding_bytes = 0;
+
+            // allocations served from the free lists
+            uint64_t pool_hits = 0;
+
+            // allocations of pooled size classes which missed the free lists
+            uint64_t pool_misses = 0;
+        };
+
+    private:
+        struct FreeBlock
+        {
+            FreeBlock* next;
+        };
+
+        // v8 may free backing stores on its GC threads
+        mutable SpinLock lock_;
+        FreeBlock* free_lists_[kClassNum] = {};
+        size_t pool_limit_;
+        Stats stats_;
+
+    public:
+        explicit ArrayBufferAllocator(size_t p_pool_limit = JSB_ARRAY_BUFFER_POOL_LIMIT) : pool_limit_(p_pool_limit) {}
+        virtual ~ArrayBufferAllocator() override;
+
+        ArrayBufferAllocator(const ArrayBufferAllocator&) = delete;
+        ArrayBufferAllocator& operator=(const ArrayBufferAllocator&) = delete;
+
         virtual void* Allocate(size_t length) override
         {
-            void* p = memalloc(length);
+            void* p = allocate(length);
             memset(p, 0, length);
             return p;
         }
 
         virtual void* AllocateUninitialized(size_t length) override
         {
-            return memalloc(length);
+            return allocate(length);
         }
 
-        virtual void Free(void* data, size_t length) override
+        virtual void Free(void* data, size_t length) override;
+
+        // max bytes kept in the free lists (0 to disable pooling), the free lists are trimmed if exceeded
+        void set_pool_limit(size_t p_pool_limit);
+
+        // release all cached blocks
+        void trim() { trim_to(0); }
+
+        Stats get_stats() const;
+
+    private:
+        // index of the size class, or -1 if not pooled
+        jsb_force_inline static int get_class_index(size_t p_length)
         {
-            memfree(data);
+            if (p_length <= kMinClassSize) return 0;
+            if (p_length > kMaxClassSize) return -1;
+            return (int) get_shift_from_power_of_2(next_power_of_2((uint32_t) p_length)) - kMinClassShift;
         }
+
+        void* allocate(size_t p_length);
+        void trim_to(size_t p_pooled_bytes);
     };
 }
 
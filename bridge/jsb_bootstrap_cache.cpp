@@ -0,0 +1,85 @@
+#include "jsb_bootstrap_cache.h"
+
+namespace jsb
+{
+    namespace
+    {
+        struct BootstrapCacheEntry
+        {
+            const char* source = nullptr;
+            int len = 0;
+            Vector<uint8_t> data;
+        };
+
+        struct BootstrapCacheState
+        {
+            BinaryMutex lock;
+            HashMap<String, BootstrapCacheEntry> entries;
+            uint64_t hits = 0;
+            uint64_t misses = 0;
+        };
+
+        BootstrapCacheState& get_state()
+        {
+            static BootstrapCacheState state;
+            return state;
+        }
+    }
+
+    v8::MaybeLocal<v8::Value> BootstrapCache::compile_function(const v8::Local<v8::Context>& p_context, const char* p_source, int p_len, const String& p_name)
+    {
+#if JSB_WITH_BOOTSTRAP_CACHE
+        BootstrapCacheState& state = get_state();
+
+        // copy-on-write, it's cheap to copy and safe to compile without holding the lock
+        Vector<uint8_t> data;
+        {
+            MutexLock lock(state.lock);
+            if (const BootstrapCacheEntry* entry = state.entries.getptr(p_name); entry && entry->source == p_source && entry->len == p_len)
+            {
+                data = entry->data;
+            }
+        }
+
+        const bool hit = !data.is_empty();
+        const v8::MaybeLocal<v8::Value> rval = impl::Helper::compile_function_cached(p_context, p_source, p_len, p_name, data);
+        {
+            MutexLock lock(state.lock);
+            if (hit) ++state.hits;
+            else ++state.misses;
+
+            // the cache may be regenerated if it's rejected by the runtime
+            if (!data.is_empty())
+            {
+                state.entries[p_name] = { p_source, p_len, data };
+            }
+        }
+        JSB_LOG(Verbose, "bootstrap script %s (cache %s, %d bytes)", p_name, hit ? "hit" : "miss", data.size());
+        return rval;
+#else
+        return impl::Helper::compile_function(p_context, p_source, p_len, p_name);
+#endif
+    }
+
+    BootstrapCache::Stats BootstrapCache::get_stats()
+    {
+        BootstrapCacheState& state = get_state();
+        MutexLock lock(state.lock);
+        Stats stats;
+        stats.entries = state.entries.size();
+        for (const KeyValue<String, BootstrapCacheEntry>& kv : state.entries)
+        {
+            stats.bytes += kv.value.data.size();
+        }
+        stats.hits = state.hits;
+        stats.misses = state.misses;
+        return stats;
+    }
+
+    void BootstrapCache::clear()
+    {
+        BootstrapCacheState& state = get_state();
+        MutexLock lock(state.lock);
+        state.entries.clear();
+    }
+}
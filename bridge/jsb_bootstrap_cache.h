@@ -0,0 +1,30 @@
+#ifndef GODOTJS_BOOTSTRAP_CACHE_H
+#define GODOTJS_BOOTSTRAP_CACHE_H
+#include "jsb_bridge_pch.h"
+
+namespace jsb
+{
+    // Process-wide cache of the compiled internal scripts (the embedded bundles loaded by every Environment on bootstrapping).
+    // The first Environment compiles the source and keeps the code cache (bytecode in QuickJS, code cache in v8),
+    // the following ones (workers, shadow environments) instantiate the scripts from it without parsing.
+    class BootstrapCache
+    {
+    public:
+        struct Stats
+        {
+            int entries = 0;
+            int64_t bytes = 0;
+            uint64_t hits = 0;
+            uint64_t misses = 0;
+        };
+
+        // [thread safe] compile (or instantiate from the cache) and run the source, the completion value is returned.
+        // NOTE: the cache entry is identified by the name and the address of the source, the source must be static.
+        static v8::MaybeLocal<v8::Value> compile_function(const v8::Local<v8::Context>& p_context, const char* p_source, int p_len, const String& p_name);
+
+        static Stats get_stats();
+        static void clear();
+    };
+}
+
+#endif
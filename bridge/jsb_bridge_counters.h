@@ -0,0 +1,102 @@
+#ifndef GODOTJS_BRIDGE_COUNTERS_H
+#define GODOTJS_BRIDGE_COUNTERS_H
+
+#include "jsb_bridge_pch.h"
+
+#if JSB_WITH_BRIDGE_COUNTERS
+#   define JSB_BRIDGE_COUNTER_INC(Env, Crossing) (Env)->get_bridge_counters().on_crossing(::jsb::BridgeCounters::Crossing)
+#   define JSB_BRIDGE_COUNTER_JS_TO_GD(Env, Type) (Env)->get_bridge_counters().on_js_to_gd(Type)
+#   define JSB_BRIDGE_COUNTER_GD_TO_JS(Env, Type) (Env)->get_bridge_counters().on_gd_to_js(Type)
+#else
+#   define JSB_BRIDGE_COUNTER_INC(Env, Crossing) (void) 0
+#   define JSB_BRIDGE_COUNTER_JS_TO_GD(Env, Type) (void) 0
+#   define JSB_BRIDGE_COUNTER_GD_TO_JS(Env, Type) (void) 0
+#endif
+
+namespace jsb
+{
+    // Counters of the bridge traffic in an Environment.
+    // Not thread-safe, they are only updated on the thread of the Environment.
+    struct BridgeCounters
+    {
+        enum Crossing : uint8_t
+        {
+            // JS to native: godot object method calls (`_godot_object_method`)
+            ObjectMethodCall,
+            // JS to native: builtin (Variant) method calls (`call_builtin_function`)
+            BuiltinFunctionCall,
+            // native to JS: script instance method calls (`call_script_method`)
+            ScriptMethodCall,
+            // native to JS: callable calls (`JSCallable::call`)
+            CallableCall,
+            // boxed variants allocated (`alloc_variant`)
+            VariantAlloc,
+
+            CrossingNum,
+        };
+
+        struct Snapshot
+        {
+            uint64_t crossings[CrossingNum] = {};
+
+            // conversions by Variant type.
+            // NOTE: js_to_gd[NIL] counts the conversions without an expected type (the type is decided by the JS value)
+            uint64_t js_to_gd[Variant::VARIANT_MAX] = {};
+            uint64_t gd_to_js[Variant::VARIANT_MAX] = {};
+
+            uint64_t get_js_to_gd_num() const
+            {
+                uint64_t sum = 0;
+                for (const uint64_t n : js_to_gd) sum += n;
+                return sum;
+            }
+
+            uint64_t get_gd_to_js_num() const
+            {
+                uint64_t sum = 0;
+                for (const uint64_t n : gd_to_js) sum += n;
+                return sum;
+            }
+        };
+
+    private:
+        Snapshot total_;
+        Snapshot frame_begin_;
+        Snapshot last_frame_;
+
+    public:
+        jsb_force_inline void on_crossing(Crossing p_crossing) { ++total_.crossings[p_crossing]; }
+        jsb_force_inline void on_js_to_gd(Variant::Type p_type) { ++total_.js_to_gd[p_type]; }
+        jsb_force_inline void on_gd_to_js(Variant::Type p_type) { ++total_.gd_to_js[p_type]; }
+
+        // accumulated counters since the Environment created
+        jsb_force_inline const Snapshot& get_total() const { return total_; }
+
+        // counters in the last frame (or the last update loop for workers)
+        jsb_force_inline const Snapshot& get_last_frame() const { return last_frame_; }
+
+        // called at the beginning of each update loop of the Environment
+        void end_frame()
+        {
+            for (int i = 0; i < CrossingNum; ++i) last_frame_.crossings[i] = total_.crossings[i] - frame_begin_.crossings[i];
+            for (int i = 0; i < Variant::VARIANT_MAX; ++i) last_frame_.js_to_gd[i] = total_.js_to_gd[i] - frame_begin_.js_to_gd[i];
+            for (int i = 0; i < Variant::VARIANT_MAX; ++i) last_frame_.gd_to_js[i] = total_.gd_to_js[i] - frame_begin_.gd_to_js[i];
+            frame_begin_ = total_;
+        }
+
+        static const char* get_crossing_name(Crossing p_crossing)
+        {
+            switch (p_crossing)
+            {
+            case ObjectMethodCall: return "object_method_calls";
+            case BuiltinFunctionCall: return "builtin_function_calls";
+            case ScriptMethodCall: return "script_method_calls";
+            case CallableCall: return "callable_calls";
+            case VariantAlloc: return "variant_allocs";
+            default: return "unknown";
+            }
+        }
+    };
+}
+
+#endif
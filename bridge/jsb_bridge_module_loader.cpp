@@ -1,6 +1,7 @@
 #include "jsb_bridge_module_loader.h"
 #include "jsb_type_convert.h"
 #include "jsb_editor_utility_funcs.h"
+#include "jsb_container_funcs.h"
 #include "jsb_callable.h"
 
 namespace jsb
@@ -67,10 +68,9 @@ namespace jsb
                 jsb_throw(isolate, "bad function");
                 return;
             }
-            const EnvironmentID env_id = env->id();
             const v8::Local<v8::Function> js_func = info[func_arg_index].As<v8::Function>();
             const ObjectCacheID callback_id = env->get_cached_function(js_func);
-            const Variant callable = Callable(memnew(JSCallable(caller_id, env_id, callback_id)));
+            const Variant callable = Callable(memnew(JSCallable(caller_id, env, callback_id)));
             v8::Local<v8::Value> rval;
             if (!TypeConvert::gd_var_to_js(isolate, context, callable, rval))
             {
@@ -80,6 +80,134 @@ namespace jsb
             info.GetReturnValue().Set(rval);
         }
 
+        // [js] Signal.prototype.emit(...args: any[]): void;
+        // Connected JSCallables of the current environment are called directly with the javascript arguments,
+        // the arguments are translated into Variants only if there are other receivers (native methods, GDScript, other environments).
+        // Emission with deferred connections is left to the engine (`Object::emit_signalp`).
+        // The emitter is looked up again after each receiver, since a receiver may free it (it stops the emission like the engine does).
+        void _emit_signal(const v8::FunctionCallbackInfo<v8::Value>& info)
+        {
+            v8::Isolate* isolate = info.GetIsolate();
+            v8::HandleScope handle_scope(isolate);
+            const v8::Local<v8::Context> context = isolate->GetCurrentContext();
+            const v8::Local<v8::Object> self = info.This();
+            const Variant* signal_var = TypeConvert::is_variant(self) ? (const Variant*) self->GetAlignedPointerFromInternalField(IF_Pointer) : nullptr;
+            if (!signal_var || signal_var->get_type() != Variant::SIGNAL)
+            {
+                jsb_throw(isolate, "bad signal");
+                return;
+            }
+
+            const Signal signal = *signal_var;
+            Object* obj = signal.get_object();
+            if (!obj || obj->is_blocking_signals())
+            {
+                return;
+            }
+
+            const StringName& name = signal.get_name();
+#ifdef DEBUG_ENABLED
+            if (!obj->has_signal(name))
+            {
+                // same as `Object::emit_signalp`
+                JSB_LOG(Error, "Can't emit non-existing signal \"%s\".", name);
+                return;
+            }
+#endif
+            List<Object::Connection> connections;
+            obj->get_signal_connection_list(name, &connections);
+            if (connections.is_empty())
+            {
+                return;
+            }
+            const ObjectID obj_id = obj->get_instance_id();
+
+            const int argc = info.Length();
+            Vector<Variant> args;
+            Vector<const Variant*> argv;
+            const auto translate_args = [&]() -> bool
+            {
+                if (args.size() == argc) return true;
+                args.resize(argc);
+                argv.resize(argc);
+                for (int index = 0; index < argc; ++index)
+                {
+                    if (!TypeConvert::js_to_gd_var(isolate, context, info[index], args.write[index]))
+                    {
+                        jsb_throw(isolate, "bad argument");
+                        return false;
+                    }
+                    argv.write[index] = &args[index];
+                }
+                return true;
+            };
+
+            constexpr uint32_t kDirectFlags = Object::CONNECT_PERSIST | Object::CONNECT_ONE_SHOT | Object::CONNECT_REFERENCE_COUNTED;
+            for (const Object::Connection& connection : connections)
+            {
+                if (connection.flags & ~kDirectFlags)
+                {
+                    if (translate_args())
+                    {
+                        obj->emit_signalp(name, argv.ptr(), argc);
+                    }
+                    return;
+                }
+            }
+
+            Environment* env = Environment::wrap(isolate);
+            using LocalValue = v8::Local<v8::Value>;
+            LocalValue* js_argv = jsb_stackalloc(LocalValue, argc);
+            for (int index = 0; index < argc; ++index)
+            {
+                memnew_placement(&js_argv[index], LocalValue(info[index]));
+            }
+
+            for (const Object::Connection& connection : connections)
+            {
+                obj = jsb::compat::ObjectDB::get_instance(obj_id);
+                if (!obj)
+                {
+                    // freed by the previous receiver
+                    break;
+                }
+                const Callable& callable = connection.callable;
+                if (!callable.is_valid())
+                {
+                    continue;
+                }
+                if (connection.flags & Object::CONNECT_ONE_SHOT)
+                {
+                    obj->disconnect(name, callable);
+                }
+
+                const JSCallable* js_callable = JSCallable::cast(callable);
+                if (js_callable && js_callable->is_bound_to(env))
+                {
+                    const ObjectID object_id = js_callable->get_object();
+                    env->call_function(context, object_id.is_null() ? nullptr : jsb::compat::ObjectDB::get_instance(object_id), js_callable->get_callback_id(), argc, js_argv);
+                    continue;
+                }
+
+                if (!translate_args())
+                {
+                    break;
+                }
+                Variant rval;
+                Callable::CallError error;
+                callable.callp(argv.ptr(), argc, rval, error);
+                if (error.error != Callable::CallError::CALL_OK)
+                {
+                    JSB_LOG(Error, "error calling from signal '%s' to callable: %s", name, Variant::get_callable_error_text(callable, argv.ptr(), argc, error));
+                }
+            }
+
+            for (int index = 0; index < argc; ++index)
+            {
+                js_argv[index].~LocalValue();
+            }
+        }
+
         // function (target: any): void;
         void _add_script_tool(const v8::FunctionCallbackInfo<v8::Value>& info)
         {
@@ -114,6 +242,102 @@ namespace jsb
             jsb_throw(isolate, "bad param");
         }
 
+        // [js] function start(): void;
+        void _profiler_start(const v8::FunctionCallbackInfo<v8::Value>& info)
+        {
+            if (!Thread::is_main_thread())
+            {
+                jsb_throw(info.GetIsolate(), "profiler is only available on the main thread");
+                return;
+            }
+            internal::CallProfiler::start_trace();
+        }
+
+        // [js] function stop(): void;
+        void _profiler_stop(const v8::FunctionCallbackInfo<v8::Value>& info)
+        {
+            if (!Thread::is_main_thread())
+            {
+                jsb_throw(info.GetIsolate(), "profiler is only available on the main thread");
+                return;
+            }
+            internal::CallProfiler::stop_trace();
+        }
+
+        // [js] function save(path: string): boolean;
+        void _profiler_save(const v8::FunctionCallbackInfo<v8::Value>& info)
+        {
+            v8::Isolate* isolate = info.GetIsolate();
+            if (!Thread::is_main_thread())
+            {
+                jsb_throw(isolate, "profiler is only available on the main thread");
+                return;
+            }
+            if (!info[0]->IsString())
+            {
+                jsb_throw(isolate, "bad path");
+                return;
+            }
+            const String path = impl::Helper::to_string(isolate, info[0]);
+            info.GetReturnValue().Set(v8::Boolean::New(isolate, internal::CallProfiler::save_trace(path) == OK));
+        }
+
+        // [js] function get_usage(): { used: number, soft_limit: number, hard_limit: number, level: string };
+        void _memory_get_usage(const v8::FunctionCallbackInfo<v8::Value>& info)
+        {
+            v8::Isolate* isolate = info.GetIsolate();
+            const v8::Local<v8::Context> context = isolate->GetCurrentContext();
+            const Environment* environment = Environment::wrap(isolate);
+            const MemoryBudget& budget = environment->get_memory_budget();
+
+            const v8::Local<v8::Object> usage = v8::Object::New(isolate);
+            usage->Set(context, impl::Helper::new_string_ascii(isolate, "used"), v8::Number::New(isolate, (double) environment->get_memory_used())).Check();
+            usage->Set(context, impl::Helper::new_string_ascii(isolate, "soft_limit"), v8::Number::New(isolate, (double) budget.soft_limit)).Check();
+            usage->Set(context, impl::Helper::new_string_ascii(isolate, "hard_limit"), v8::Number::New(isolate, (double) budget.hard_limit)).Check();
+            usage->Set(context, impl::Helper::new_string_ascii(isolate, "level"), impl::Helper::new_string_ascii(isolate, MemoryPressureLevel::get_name(environment->get_memory_pressure_level()))).Check();
+            info.GetReturnValue().Set(usage);
+        }
+
+        // [js] function set_pressure_callback(callback: ((level: string, used: number) => void) | null): void;
+        void _memory_set_pressure_callback(const v8::FunctionCallbackInfo<v8::Value>& info)
+        {
+            v8::Isolate* isolate = info.GetIsolate();
+            Environment* environment = Environment::wrap(isolate);
+            if (info[0]->IsNullOrUndefined())
+            {
+                environment->set_memory_pressure_callback({});
+                return;
+            }
+            if (!info[0]->IsFunction())
+            {
+                jsb_throw(isolate, "bad callback");
+                return;
+            }
+            environment->set_memory_pressure_callback(info[0].As<v8::Function>());
+        }
+
+        // read the module sources in background ahead of demand, then `require` of them doesn't touch the file system
+        // [js] function prefetch(...module_ids: string[]): number;
+        void _prefetch(const v8::FunctionCallbackInfo<v8::Value>& info)
+        {
+            v8::Isolate* isolate = info.GetIsolate();
+            Environment* environment = Environment::wrap(isolate);
+            int queued = 0;
+            for (int index = 0, argc = info.Length(); index < argc; ++index)
+            {
+                if (!info[index]->IsString())
+                {
+                    jsb_throw(isolate, "bad module_id");
+                    return;
+                }
+                if (ModuleFetcher::prefetch(environment, impl::Helper::to_string(isolate, info[index])))
+                {
+                    ++queued;
+                }
+            }
+            info.GetReturnValue().Set(queued);
+        }
+
         void _notify_microtasks_run(const v8::FunctionCallbackInfo<v8::Value>& info)
         {
             Environment* environment = Environment::wrap(info.GetIsolate());
@@ -456,6 +680,28 @@ namespace jsb
             jsb_obj->Set(context, impl::Helper::new_string_ascii(isolate, "impl"), impl::Helper::new_string(isolate, JSB_IMPL_VERSION_STRING)).Check();
             jsb_obj->Set(context, impl::Helper::new_string_ascii(isolate, "callable"), JSB_NEW_FUNCTION(context, _new_callable, {})).Check();
             jsb_obj->Set(context, impl::Helper::new_string_ascii(isolate, "to_array_buffer"), JSB_NEW_FUNCTION(context, _to_array_buffer, {})).Check();
+            jsb_obj->Set(context, impl::Helper::new_string_ascii(isolate, "prefetch"), JSB_NEW_FUNCTION(context, _prefetch, {})).Check();
+
+            // jsb.profiler
+            {
+                v8::Local<v8::Object> profiler_obj = v8::Object::New(isolate);
+
+                jsb_obj->Set(context, impl::Helper::new_string_ascii(isolate, "profiler"), profiler_obj).Check();
+
+                profiler_obj->Set(context, impl::Helper::new_string_ascii(isolate, "start"), JSB_NEW_FUNCTION(context, _profiler_start, {})).Check();
+                profiler_obj->Set(context, impl::Helper::new_string_ascii(isolate, "stop"), JSB_NEW_FUNCTION(context, _profiler_stop, {})).Check();
+                profiler_obj->Set(context, impl::Helper::new_string_ascii(isolate, "save"), JSB_NEW_FUNCTION(context, _profiler_save, {})).Check();
+            }
+
+            // jsb.memory
+            {
+                v8::Local<v8::Object> memory_obj = v8::Object::New(isolate);
+
+                jsb_obj->Set(context, impl::Helper::new_string_ascii(isolate, "memory"), memory_obj).Check();
+
+                memory_obj->Set(context, impl::Helper::new_string_ascii(isolate, "get_usage"), JSB_NEW_FUNCTION(context, _memory_get_usage, {})).Check();
+                memory_obj->Set(context, impl::Helper::new_string_ascii(isolate, "set_pressure_callback"), JSB_NEW_FUNCTION(context, _memory_set_pressure_callback, {})).Check();
+            }
 
             // jsb.internal
             {
@@ -475,6 +721,10 @@ namespace jsb
                 internal_obj->Set(context, impl::Helper::new_string_ascii(isolate, "set_script_doc"), JSB_NEW_FUNCTION(context, _set_script_doc, {})).Check();
                 internal_obj->Set(context, impl::Helper::new_string_ascii(isolate, "notify_microtasks_run"), JSB_NEW_FUNCTION(context, _notify_microtasks_run, {})).Check();
                 internal_obj->Set(context, impl::Helper::new_string_ascii(isolate, "get_type_name"), JSB_NEW_FUNCTION(context, _get_type_name, {})).Check();
+                internal_obj->Set(context, impl::Helper::new_string_ascii(isolate, "emit_signal"), JSB_NEW_FUNCTION(context, _emit_signal, {})).Check();
+
+                // jsb.internal.container
+                ContainerFuncs::expose(isolate, context, internal_obj);
             }
 
             // internal 'jsb.editor'
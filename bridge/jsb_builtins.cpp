@@ -87,4 +87,26 @@ namespace jsb
         JSB_LOG(Error, "can not load module '%s' (with parent '%s')", module_id, parent_id);
     }
 
+    void Builtins::_require_async(const v8::FunctionCallbackInfo<v8::Value>& info)
+    {
+        v8::Isolate* isolate = info.GetIsolate();
+        v8::Local<v8::Context> context = isolate->GetCurrentContext();
+
+        if (info.Length() != 1 || !info[0]->IsString())
+        {
+            jsb_throw(isolate, "bad argument");
+            return;
+        }
+
+        // read parent module id from magic data (same as `_require`)
+        const String parent_id = impl::Helper::to_string(isolate, info.Data());
+        const String module_id = impl::Helper::to_string(isolate, info[0]);
+        Environment* env = Environment::wrap(context);
+
+        if (v8::Local<v8::Value> promise; env->module_fetcher_.fetch(env, parent_id, module_id).ToLocal(&promise))
+        {
+            info.GetReturnValue().Set(promise);
+        }
+    }
+
 }
@@ -8,6 +8,7 @@ namespace jsb
     {
     public:
         static void _require(const v8::FunctionCallbackInfo<v8::Value>& info);
+        static void _require_async(const v8::FunctionCallbackInfo<v8::Value>& info);
         static void _define(const v8::FunctionCallbackInfo<v8::Value>& info);
 
     };
@@ -12,7 +12,7 @@ namespace jsb
     {
         if (callback_id_)
         {
-            if (const std::shared_ptr<jsb::Environment> env = jsb::Environment::_access(env_id_))
+            if (const std::shared_ptr<jsb::Environment> env = env_.lock())
             {
                 env->release_function(callback_id_);
             }
@@ -21,13 +21,22 @@ namespace jsb
 
     void JSCallable::call(const Variant** p_arguments, int p_argcount, Variant& r_return_value, Callable::CallError& r_call_error) const
     {
-        const std::shared_ptr<jsb::Environment> env = jsb::Environment::_access(env_id_);
+        const std::shared_ptr<jsb::Environment> env = env_.lock();
         if (!env)
         {
             r_call_error.error = Callable::CallError::CALL_ERROR_INVALID_METHOD;
             return;
         }
 
+        if (!env->is_caller_thread())
+        {
+            JSB_LOG(Error, "can not call JS callable from a different thread");
+            r_call_error.error = Callable::CallError::CALL_ERROR_INVALID_METHOD;
+            return;
+        }
+
+        // counted only on the thread of the Environment (the counters are not atomic)
+        JSB_BRIDGE_COUNTER_INC(env, CallableCall);
         Object* object_ptr = object_id_.is_null() ? nullptr : jsb::compat::ObjectDB::get_instance(object_id_);
         env->call_function(object_ptr, callback_id_, p_arguments, p_argcount, r_call_error);
     }
@@ -12,6 +12,9 @@ namespace jsb
         jsb::ObjectCacheID callback_id_;
         jsb::EnvironmentID env_id_;
 
+        // resolved without the lock of the environment store, since a callable can be called or released from any thread
+        jsb::EnvironmentHandle env_;
+
     public:
         static bool _compare_equal(const CallableCustom* p_a, const CallableCustom* p_b)
         {
@@ -29,13 +32,26 @@ namespace jsb
             // return !_compare_equal(p_a, p_b) && p_a < p_b;
         }
 
-        JSCallable(ObjectID p_object_id, jsb::EnvironmentID p_env_id, jsb::ObjectCacheID p_callback_id)
-            : object_id_(p_object_id), callback_id_(p_callback_id), env_id_(p_env_id)
+        JSCallable(ObjectID p_object_id, jsb::Environment* p_env, jsb::ObjectCacheID p_callback_id)
+            : object_id_(p_object_id), callback_id_(p_callback_id), env_id_(p_env->id()), env_(p_env->get_handle())
         {
         }
 
         virtual ~JSCallable() override;
 
+        jsb_force_inline jsb::EnvironmentID get_env_id() const { return env_id_; }
+
+        // whether it's created in `p_env` (not in a disposed one which happened to be allocated at the same address)
+        bool is_bound_to(const jsb::Environment* p_env) const { return env_id_ == p_env->id() && env_.lock().get() == p_env; }
+        jsb_force_inline jsb::ObjectCacheID get_callback_id() const { return callback_id_; }
+
+        // the JSCallable of `p_callable`, nullptr if it's not a JSCallable
+        static const JSCallable* cast(const Callable& p_callable)
+        {
+            const CallableCustom* custom = p_callable.get_custom();
+            return custom && custom->get_compare_equal_func() == _compare_equal ? (const JSCallable*) custom : nullptr;
+        }
+
         /**
          * it's a free callable object if object_id_ is explicitly assigned as zero.
          * otherwise, do the same thing in CallableCustom::is_valid().
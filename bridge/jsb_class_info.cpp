@@ -76,6 +76,7 @@ namespace jsb
         p_class_info->properties.clear();
         p_class_info->rpc_config.clear();
         p_class_info->method_cache.clear();
+        p_class_info->onready_plan.clear();
         p_class_info->flags = ScriptClassFlags::None;
 
         JSB_LOG(VeryVerbose, "godot js class name %s (native: %s)", p_class_info->js_class_name, p_class_info->native_class_name);
@@ -217,6 +217,34 @@ namespace jsb
         jsb_force_inline bool is_abstract() const { return flags & ScriptClassFlags::Abstract; }
     };
 
+    // precomputed `@onready` fields of a script class, compiled on the first `_ready` of its instances
+    struct ScriptOnReadyPlan
+    {
+        struct Field
+        {
+            StringName name;
+
+            // parsed only once for all instances, empty if evaluated by a function
+            NodePath node_path;
+
+            // index in the original `@onready` collection (only used for function evaluators)
+            uint32_t index = 0;
+        };
+
+        bool compiled = false;
+        Vector<Field> fields;
+
+        // the original `@onready` collection, retained only if any function evaluator exists
+        v8::Global<v8::Array> collection;
+
+        void clear()
+        {
+            compiled = false;
+            fields.clear();
+            collection.Reset();
+        }
+    };
+
     struct ScriptClassInfo : StatelessScriptClassInfo
     {
         // the native class id the current class inherits from.
@@ -232,6 +260,8 @@ namespace jsb
 
         internal::TypeGen<StringName, v8::Global<v8::Function>>::UnorderedMap method_cache;
 
+        ScriptOnReadyPlan onready_plan;
+
         static void instantiate(const StringName& p_module_id, const v8::Local<v8::Object>& p_self);
 
         static bool _parse_script_class(const v8::Local<v8::Context>& p_context, JavaScriptModule& p_module);
@@ -0,0 +1,260 @@
+#include "jsb_container_funcs.h"
+#include "jsb_type_convert.h"
+
+namespace jsb
+{
+    namespace
+    {
+        // the boxed Array/Dictionary of the first argument, nullptr (with an exception thrown) if not
+        Variant* get_container(const v8::FunctionCallbackInfo<v8::Value>& info)
+        {
+            if (info.Length() > 0 && info[0]->IsObject())
+            {
+                const v8::Local<v8::Object> self = info[0].As<v8::Object>();
+                if (TypeConvert::is_variant(self))
+                {
+                    Variant* target = (Variant*) self->GetAlignedPointerFromInternalField(IF_Pointer);
+                    if (target && (target->get_type() == Variant::ARRAY || target->get_type() == Variant::DICTIONARY))
+                    {
+                        return target;
+                    }
+                }
+            }
+            jsb_throw(info.GetIsolate(), "not an Array or Dictionary");
+            return nullptr;
+        }
+
+        // array index from a JS number, -1 if not an integer index
+        int64_t get_index(const v8::Local<v8::Value>& p_value)
+        {
+            if (p_value->IsInt32()) return p_value.As<v8::Int32>()->Value();
+            if (p_value->IsNumber())
+            {
+                const double number = p_value.As<v8::Number>()->Value();
+                if (number >= 0 && number <= (double) INT32_MAX && (double)(int64_t) number == number) return (int64_t) number;
+            }
+            return -1;
+        }
+
+        // [js] function size(target: GArray | GDictionary): number;
+        void _size(const v8::FunctionCallbackInfo<v8::Value>& info)
+        {
+            const Variant* target = get_container(info);
+            if (!target) return;
+            const int size = target->get_type() == Variant::ARRAY
+                ? VariantInternal::get_array(target)->size()
+                : VariantInternal::get_dictionary(target)->size();
+            info.GetReturnValue().Set(v8::Int32::New(info.GetIsolate(), size));
+        }
+
+        // [js] function get(target: GArray | GDictionary, key: any): any;
+        // return undefined if the index is out of range or the key does not exist
+        void _get(const v8::FunctionCallbackInfo<v8::Value>& info)
+        {
+            const Variant* target = get_container(info);
+            if (!target) return;
+            v8::Isolate* isolate = info.GetIsolate();
+            const v8::Local<v8::Context> context = isolate->GetCurrentContext();
+            const Variant* element = nullptr;
+            if (target->get_type() == Variant::ARRAY)
+            {
+                const Array& array = *VariantInternal::get_array(target);
+                const int64_t index = get_index(info[1]);
+                if (index >= 0 && index < array.size()) element = &array[(int) index];
+            }
+            else
+            {
+                Variant key;
+                if (!TypeConvert::js_to_gd_var(isolate, context, info[1], key))
+                {
+                    jsb_throw(isolate, "bad key");
+                    return;
+                }
+                element = VariantInternal::get_dictionary(target)->getptr(key);
+            }
+            if (!element) return;
+
+            v8::Local<v8::Value> rval;
+            if (!TypeConvert::gd_var_to_js(isolate, context, *element, rval))
+            {
+                jsb_throw(isolate, "failed to translate the element");
+                return;
+            }
+            info.GetReturnValue().Set(rval);
+        }
+
+        // [js] function set(target: GArray | GDictionary, key: any, value: any): boolean;
+        // array elements can only be replaced (return false if the index is out of range)
+        void _set(const v8::FunctionCallbackInfo<v8::Value>& info)
+        {
+            Variant* target = get_container(info);
+            if (!target) return;
+            v8::Isolate* isolate = info.GetIsolate();
+            const v8::Local<v8::Context> context = isolate->GetCurrentContext();
+            Variant value;
+            if (!TypeConvert::js_to_gd_var(isolate, context, info[2], value))
+            {
+                jsb_throw(isolate, "bad value");
+                return;
+            }
+            bool succeeded = false;
+            if (target->get_type() == Variant::ARRAY)
+            {
+                Array& array = *VariantInternal::get_array(target);
+                const int64_t index = get_index(info[1]);
+                if (index >= 0 && index < array.size() && !array.is_read_only())
+                {
+                    array.set((int) index, value);
+                    succeeded = true;
+                }
+            }
+            else
+            {
+                Variant key;
+                if (!TypeConvert::js_to_gd_var(isolate, context, info[1], key))
+                {
+                    jsb_throw(isolate, "bad key");
+                    return;
+                }
+                Dictionary& dict = *VariantInternal::get_dictionary(target);
+                if (!dict.is_read_only())
+                {
+                    dict[key] = value;
+                    succeeded = true;
+                }
+            }
+            info.GetReturnValue().Set(v8::Boolean::New(isolate, succeeded));
+        }
+
+        // [js] function has(target: GArray | GDictionary, key: any): boolean;
+        void _has(const v8::FunctionCallbackInfo<v8::Value>& info)
+        {
+            const Variant* target = get_container(info);
+            if (!target) return;
+            v8::Isolate* isolate = info.GetIsolate();
+            bool found;
+            if (target->get_type() == Variant::ARRAY)
+            {
+                const int64_t index = get_index(info[1]);
+                found = index >= 0 && index < VariantInternal::get_array(target)->size();
+            }
+            else
+            {
+                Variant key;
+                found = TypeConvert::js_to_gd_var(isolate, isolate->GetCurrentContext(), info[1], key) && VariantInternal::get_dictionary(target)->has(key);
+            }
+            info.GetReturnValue().Set(v8::Boolean::New(isolate, found));
+        }
+
+        // [js] function erase(target: GDictionary, key: any): boolean;
+        void _erase(const v8::FunctionCallbackInfo<v8::Value>& info)
+        {
+            Variant* target = get_container(info);
+            if (!target) return;
+            v8::Isolate* isolate = info.GetIsolate();
+            bool erased = false;
+            if (target->get_type() == Variant::DICTIONARY)
+            {
+                Variant key;
+                Dictionary& dict = *VariantInternal::get_dictionary(target);
+                erased = TypeConvert::js_to_gd_var(isolate, isolate->GetCurrentContext(), info[1], key) && !dict.is_read_only() && dict.erase(key);
+            }
+            info.GetReturnValue().Set(v8::Boolean::New(isolate, erased));
+        }
+
+        // [js] function keys(target: GArray | GDictionary): string[];
+        // indices of an array, or the string keys of a dictionary (other keys are not representable as property keys)
+        void _keys(const v8::FunctionCallbackInfo<v8::Value>& info)
+        {
+            const Variant* target = get_container(info);
+            if (!target) return;
+            v8::Isolate* isolate = info.GetIsolate();
+            const v8::Local<v8::Context> context = isolate->GetCurrentContext();
+            v8::Local<v8::Array> keys;
+            if (target->get_type() == Variant::ARRAY)
+            {
+                const int size = VariantInternal::get_array(target)->size();
+                keys = v8::Array::New(isolate, size);
+                for (int index = 0; index < size; ++index)
+                {
+                    keys->Set(context, index, impl::Helper::new_string_ascii(isolate, itos(index))).Check();
+                }
+            }
+            else
+            {
+                const Dictionary& dict = *VariantInternal::get_dictionary(target);
+                keys = v8::Array::New(isolate);
+                uint32_t num = 0;
+                for (const Variant& key : dict.keys())
+                {
+                    const Variant::Type type = key.get_type();
+                    if (type != Variant::STRING && type != Variant::STRING_NAME) continue;
+                    v8::Local<v8::Value> jkey;
+                    if (TypeConvert::gd_var_to_js(isolate, context, key, jkey))
+                    {
+                        keys->Set(context, num++, jkey).Check();
+                    }
+                }
+            }
+            info.GetReturnValue().Set(keys);
+        }
+
+        // [js] function to_js(target: GArray | GDictionary): any[] | Record<string, any>;
+        // a snapshot of the container as a JS array (or a plain object keyed by the stringified keys) in one pass,
+        // nested containers are kept as Godot values
+        void _to_js(const v8::FunctionCallbackInfo<v8::Value>& info)
+        {
+            const Variant* target = get_container(info);
+            if (!target) return;
+            v8::Isolate* isolate = info.GetIsolate();
+            const v8::Local<v8::Context> context = isolate->GetCurrentContext();
+            if (target->get_type() == Variant::ARRAY)
+            {
+                const Array& array = *VariantInternal::get_array(target);
+                const int size = array.size();
+                const v8::Local<v8::Array> rval = v8::Array::New(isolate, size);
+                for (int index = 0; index < size; ++index)
+                {
+                    v8::Local<v8::Value> element;
+                    if (!TypeConvert::gd_var_to_js(isolate, context, array[index], element))
+                    {
+                        jsb_throw(isolate, "failed to translate the element");
+                        return;
+                    }
+                    rval->Set(context, index, element).Check();
+                }
+                info.GetReturnValue().Set(rval);
+            }
+            else
+            {
+                const Dictionary& dict = *VariantInternal::get_dictionary(target);
+                const v8::Local<v8::Object> rval = v8::Object::New(isolate);
+                for (const Variant& key : dict.keys())
+                {
+                    v8::Local<v8::Value> value;
+                    if (!TypeConvert::gd_var_to_js(isolate, context, *dict.getptr(key), value))
+                    {
+                        jsb_throw(isolate, "failed to translate the element");
+                        return;
+                    }
+                    rval->Set(context, impl::Helper::new_string(isolate, (String) key), value).Check();
+                }
+                info.GetReturnValue().Set(rval);
+            }
+        }
+    }
+
+    void ContainerFuncs::expose(v8::Isolate* isolate, v8::Local<v8::Context> context, v8::Local<v8::Object> internal_obj)
+    {
+        v8::Local<v8::Object> container_obj = v8::Object::New(isolate);
+
+        internal_obj->Set(context, impl::Helper::new_string_ascii(isolate, "container"), container_obj).Check();
+        container_obj->Set(context, impl::Helper::new_string_ascii(isolate, "size"), JSB_NEW_FUNCTION(context, _size, {})).Check();
+        container_obj->Set(context, impl::Helper::new_string_ascii(isolate, "get"), JSB_NEW_FUNCTION(context, _get, {})).Check();
+        container_obj->Set(context, impl::Helper::new_string_ascii(isolate, "set"), JSB_NEW_FUNCTION(context, _set, {})).Check();
+        container_obj->Set(context, impl::Helper::new_string_ascii(isolate, "has"), JSB_NEW_FUNCTION(context, _has, {})).Check();
+        container_obj->Set(context, impl::Helper::new_string_ascii(isolate, "erase"), JSB_NEW_FUNCTION(context, _erase, {})).Check();
+        container_obj->Set(context, impl::Helper::new_string_ascii(isolate, "keys"), JSB_NEW_FUNCTION(context, _keys, {})).Check();
+        container_obj->Set(context, impl::Helper::new_string_ascii(isolate, "to_js"), JSB_NEW_FUNCTION(context, _to_js, {})).Check();
+    }
+}
@@ -0,0 +1,15 @@
+#ifndef GODOTJS_CONTAINER_FUNCS_H
+#define GODOTJS_CONTAINER_FUNCS_H
+#include "jsb_bridge_pch.h"
+
+namespace jsb
+{
+    // Element access of Array/Dictionary used by the proxies in jsb.inject (`jsb.internal.container`).
+    // They operate on the storage of the boxed Variant directly, instead of dispatching the reflected methods
+    // (`get`, `set`, `has`, ...) with arguments checked and converted per call.
+    struct ContainerFuncs
+    {
+        static void expose(v8::Isolate* isolate, v8::Local<v8::Context> context, v8::Local<v8::Object> internal_obj);
+    };
+}
+#endif
@@ -241,9 +241,11 @@ namespace jsb
         JSB_BENCHMARK_SCOPE(JSEnvironment, Construct);
         impl::GlobalInitialize::init();
         v8::Isolate::CreateParams create_params;
+        allocator_.set_pool_limit((size_t) internal::Settings::get_array_buffer_pool_limit());
         create_params.array_buffer_allocator = &allocator_;
 
         if (p_params.type == Type::Worker) flags_ |= EF_Worker;
+        memory_budget_ = p_params.memory_budget;
 
         isolate_ = v8::Isolate::New(create_params);
         isolate_->SetData(kIsolateEmbedderData, this);
@@ -265,7 +267,9 @@ namespace jsb
 
         module_loaders_.insert("godot", memnew(GodotModuleLoader));
         module_loaders_.insert("godot-jsb", memnew(BridgeModuleLoader));
+        log_queue_ = internal::AsyncLogger::create_queue(&source_map_cache_);
         EnvironmentStore::get_shared().add(this);
+        alive_.set();
 
         // create context
         {
@@ -287,6 +291,7 @@ namespace jsb
                 const v8::Local<v8::Function> require_func = JSB_NEW_FUNCTION(context, Builtins::_require, {});
                 require_func->Set(context, jsb_name(this, cache), cache_obj).Check();
                 require_func->Set(context, impl::Helper::new_string_ascii(isolate_, "moduleId"), v8::String::Empty(isolate_)).Check();
+                require_func->Set(context, jsb_name(this, async), JSB_NEW_FUNCTION(context, Builtins::_require_async, {})).Check();
                 global->Set(context, impl::Helper::new_string_ascii(isolate_, "require"), require_func).Check();
                 global->Set(context, impl::Helper::new_string_ascii(isolate_, "define"), JSB_NEW_FUNCTION(context, Builtins::_define, {})).Check();
                 module_cache_.init(isolate_, cache_obj);
@@ -334,6 +339,7 @@ namespace jsb
 
         jsb_check(object_db_.size() == 0);
         string_name_cache_.clear();
+        string_value_cache_.clear();
 
         // cleanup all class templates (must do after objects cleaned up)
         native_classes_.clear();
@@ -367,6 +373,11 @@ namespace jsb
             "the embedded '%s' not found, run 'scons' again to refresh all *.gen.cpp sources", kEditorBundleFile);
 #endif
 
+        // applied after the internal scripts loaded, the environment is always able to start
+        if (memory_budget_.hard_limit != 0)
+        {
+            impl::Helper::set_memory_limit(isolate_, (size_t) memory_budget_.hard_limit);
+        }
     }
 
     void Environment::dispose()
@@ -374,6 +385,7 @@ namespace jsb
         JSB_LOG(Verbose, "disposing Environment %s", (uintptr_t) id());
 
         flags_ |= EF_PreDispose;
+        lift_memory_limit();
         // destroy context
         {
             v8::Isolate* isolate = this->isolate_;
@@ -381,9 +393,9 @@ namespace jsb
             v8::HandleScope handle_scope(isolate);
             v8::Local<v8::Context> context = context_.Get(get_isolate());
 
-            function_refs_.clear();
-            while (!function_bank_.is_empty()) function_bank_.remove_last();
-            // function_bank_.clear();
+            function_registry_.clear();
+            module_fetcher_.clear();
+            memory_pressure_callback_.Reset();
 
 #if JSB_WITH_DEBUGGER
             debugger_.on_context_destroyed(context);
@@ -418,12 +430,17 @@ namespace jsb
         }
 
         variant_allocator_.drain();
+        internal::AsyncLogger::release_queue(log_queue_);
         flags_ |= EF_PostDispose;
+        alive_.clear();
         EnvironmentStore::get_shared().remove(this);
     }
 
     void Environment::update(uint64_t p_delta_msecs)
     {
+#if JSB_WITH_BRIDGE_COUNTERS
+        bridge_counters_.end_frame();
+#endif
 #if JSB_WITH_ESSENTIALS
         if (timer_manager_.tick(p_delta_msecs))
         {
@@ -457,6 +474,7 @@ namespace jsb
         }
 
         exec_async_calls();
+        module_fetcher_.update(this);
 
         // quickjs delayed the free op after all HandleScope left, we need to swap the free op list manually explicitly.
         // otherwise, object may leak until next evacuation of HandleScope.
@@ -474,6 +492,101 @@ namespace jsb
         debugger_.update();
 #endif
         variant_allocator_.drain();
+
+        check_memory_budget();
+    }
+
+    void Environment::recycle()
+    {
+        exec_async_calls();
+        isolate_->PerformMicrotaskCheckpoint();
+        flags_ &= ~EF_MicrotaskCheckpoint;
+        string_name_cache_.clear();
+        string_value_cache_.clear();
+        source_map_cache_.clear();
+        variant_allocator_.drain();
+    }
+
+    void Environment::check_memory_budget()
+    {
+        // a worker is about to be terminated, nothing to do
+        if (!memory_budget_.is_limited() || (flags_ & EF_MemoryExceeded)) return;
+
+        const bool limit_hit = impl::Helper::check_memory_limit_hit(isolate_);
+        size_t used = impl::Helper::get_memory_used(isolate_);
+        MemoryPressureLevel::Type level = limit_hit ? MemoryPressureLevel::Exceeded : memory_budget_.get_level(used);
+
+        // try to reclaim memory before raising the critical level
+        if (level == MemoryPressureLevel::Critical)
+        {
+            const uint64_t now = OS::get_singleton()->get_ticks_msec();
+            if (last_memory_gc_msec_ == 0 || now - last_memory_gc_msec_ >= JSB_MEMORY_BUDGET_GC_INTERVAL)
+            {
+                last_memory_gc_msec_ = now;
+                _on_gc_request();
+                used = impl::Helper::get_memory_used(isolate_);
+                level = memory_budget_.get_level(used);
+                JSB_LOG(Verbose, "gc on memory soft limit reached (%d/%d bytes)", (uint64_t) used, memory_budget_.soft_limit);
+            }
+        }
+
+        if (level == memory_pressure_level_) return;
+        memory_pressure_level_ = level;
+        switch (level)
+        {
+        case MemoryPressureLevel::Exceeded:
+            JSB_LOG(Error, "memory hard limit exceeded (%d/%d bytes)", (uint64_t) used, memory_budget_.hard_limit);
+            if (flags_ & EF_Worker)
+            {
+                // the JS side is not notified, the master receives the error instead
+                flags_ |= EF_MemoryExceeded;
+                return;
+            }
+            break;
+        case MemoryPressureLevel::Critical:
+            JSB_LOG(Warning, "memory soft limit exceeded (%d/%d bytes)", (uint64_t) used, memory_budget_.soft_limit);
+            break;
+        default:
+            JSB_LOG(Verbose, "memory pressure %s (%d bytes)", MemoryPressureLevel::get_name(level), (uint64_t) used);
+            break;
+        }
+
+        if (memory_pressure_callback_.IsEmpty()) return;
+
+        v8::Isolate::Scope isolate_scope(isolate_);
+        v8::HandleScope handle_scope(isolate_);
+        const v8::Local<v8::Context> context = context_.Get(isolate_);
+        v8::Context::Scope context_scope(context);
+
+        v8::Local<v8::Value> argv[] = {
+            impl::Helper::new_string_ascii(isolate_, MemoryPressureLevel::get_name(level)),
+            v8::Number::New(isolate_, (double) used),
+        };
+        const impl::TryCatch try_catch(isolate_);
+        const v8::MaybeLocal<v8::Value> rval = memory_pressure_callback_.Get(isolate_)->Call(context, v8::Undefined(isolate_), ::std::size(argv), argv);
+        jsb_unused(rval);
+        if (try_catch.has_caught())
+        {
+            JSB_LOG(Error, "%s", BridgeHelper::get_exception(try_catch));
+        }
+    }
+
+    void Environment::lift_memory_limit()
+    {
+        if (memory_budget_.hard_limit != 0)
+        {
+            impl::Helper::set_memory_limit(isolate_, 0);
+        }
+    }
+
+    void Environment::set_memory_pressure_callback(const v8::Local<v8::Function>& p_callback)
+    {
+        if (p_callback.IsEmpty())
+        {
+            memory_pressure_callback_.Reset();
+            return;
+        }
+        memory_pressure_callback_.Reset(isolate_, p_callback);
     }
 
     // handle async calls (from InstanceBindingCallbacks)
@@ -926,27 +1039,29 @@ namespace jsb
         r_stats.native_classes = native_classes_.size();
         r_stats.script_classes = script_classes_.size();
         r_stats.cached_string_names = string_name_cache_.size();
+        r_stats.string_value_cache = string_value_cache_.get_stats();
+        r_stats.callable_functions = function_registry_.get_stats();
+        r_stats.module_fetcher = module_fetcher_.get_stats();
+        r_stats.script_sources = internal::FileManager::get_stats();
         r_stats.persistent_objects = persistent_objects_.size();
         r_stats.allocated_variants = variant_allocator_.get_allocated_num();
+        r_stats.dropped_logs = log_queue_ ? (uint32_t) log_queue_->get_stats().dropped : 0;
+        r_stats.bridge_last_frame = bridge_counters_.get_last_frame();
+
+        const ArrayBufferAllocator::Stats array_buffer_stats = allocator_.get_stats();
+        r_stats.array_buffer_pooled_bytes = array_buffer_stats.pooled_bytes;
+        r_stats.array_buffer_outstanding_bytes = array_buffer_stats.outstanding_bytes;
+
+        r_stats.memory_used = impl::Helper::get_memory_used(isolate_);
+        r_stats.memory_pressure_level = memory_pressure_level_;
     }
 
     ObjectCacheID Environment::get_cached_function(const v8::Local<v8::Function>& p_func)
     {
-        v8::Isolate* isolate = get_isolate();
-        const auto& it = function_refs_.find(TWeakRef(isolate, p_func));
-        if (it != function_refs_.end())
-        {
-            const ObjectCacheID callback_id = it->second;
-            TStrongRef<v8::Function>& strong_ref = function_bank_.get_value(callback_id);
-            strong_ref.ref();
-            return callback_id;
-        }
-        const ObjectCacheID new_id = function_bank_.add(TStrongRef(isolate, p_func));
-        function_refs_.insert(std::pair(TWeakRef(isolate, p_func), new_id));
-        return new_id;
+        return function_registry_.retain(get_isolate(), p_func);
     }
 
-    void Environment::scan_external_changes()
+    void Environment::scan_external_changes(Vector<StringName>* r_script_dependents)
     {
         check_internal_state();
         Vector<StringName> requested_modules;
@@ -961,14 +1076,38 @@ namespace jsb
             }
         }
 
+        // the dependents of the changed modules are stale too
+        const int changed_num = requested_modules.size();
+        Vector<StringName> dependents;
+        for (int i = 0; i < changed_num; ++i)
+        {
+            module_cache_.collect_dependents(requested_modules[i], dependents);
+        }
+        for (const StringName& id : dependents)
+        {
+            JavaScriptModule* module = module_cache_.find(id);
+            if (!module || !module->mark_as_dependent_reloading()) continue;
+
+            // script modules are reloaded along with the script resources, it's up to the caller to invalidate the scripts
+            if (module->script_class_id)
+            {
+                if (r_script_dependents) r_script_dependents->append(id);
+                continue;
+            }
+            requested_modules.append(id);
+        }
+
         for (const StringName& id : requested_modules)
         {
+            // may have been reloaded as a dependency of the previous one
+            const JavaScriptModule* module = module_cache_.find(id);
+            if (!module || module->is_loaded()) continue;
             JSB_LOG(Verbose, "changed module check: %s", id);
             load(id);
         }
     }
 
-    ModuleReloadResult::Type Environment::mark_as_reloading(const StringName& p_name)
+    ModuleReloadResult::Type Environment::mark_as_reloading(const StringName& p_name, Vector<StringName>* r_dependents)
     {
         check_internal_state();
         if (JavaScriptModule* module = module_cache_.find(p_name))
@@ -976,6 +1115,18 @@ namespace jsb
             jsb_check(!module->source_info.source_filepath.is_empty());
             if (!module->is_loaded() || module->mark_as_reloading())
             {
+                // only the modules importing it (directly or indirectly) need to be re-executed
+                Vector<StringName> dependents;
+                module_cache_.collect_dependents(p_name, dependents);
+                for (const StringName& id : dependents)
+                {
+                    JavaScriptModule* dependent = module_cache_.find(id);
+                    if (dependent && dependent->mark_as_dependent_reloading())
+                    {
+                        JSB_LOG(Verbose, "module %s is requested to reload as a dependent of %s", id, p_name);
+                        if (r_dependents) r_dependents->append(id);
+                    }
+                }
                 return ModuleReloadResult::Requested;
             }
             return ModuleReloadResult::NoChanges;
@@ -989,6 +1140,7 @@ namespace jsb
         JavaScriptModule* existing_module = module_cache_.find(p_module_id);
         if (existing_module && existing_module->is_loaded())
         {
+            if (!p_parent_id.is_empty()) existing_module->add_dependent(p_parent_id);
             return existing_module;
         }
 
@@ -1038,6 +1190,7 @@ namespace jsb
             existing_module = module_cache_.find(module_id);
             if (existing_module && existing_module->is_loaded())
             {
+                if (!p_parent_id.is_empty()) existing_module->add_dependent(p_parent_id);
                 return existing_module;
             }
 
@@ -1048,6 +1201,8 @@ namespace jsb
                 jsb_check(existing_module->source_info.source_filepath == source_info.source_filepath);
 
                 JSB_LOG(VeryVerbose, "reload module %s", module_id);
+                JSB_CALL_PROFILER_SCOPE(ModuleLoad, module_id, internal::CallProfiler::empty_name(), internal::CallProfiler::empty_name());
+                if (!p_parent_id.is_empty()) existing_module->add_dependent(p_parent_id);
                 existing_module->mark_as_reloaded();
                 if (!resolver->load(this, source_info.source_filepath, *existing_module))
                 {
@@ -1059,6 +1214,7 @@ namespace jsb
             else
             {
                 JSB_LOG(Verbose, "instantiating module %s", module_id);
+                JSB_CALL_PROFILER_SCOPE(ModuleLoad, module_id, internal::CallProfiler::empty_name(), internal::CallProfiler::empty_name());
                 JavaScriptModule& module = module_cache_.insert(isolate, context, module_id, true, false);
                 v8::Local<v8::Object> exports_obj = v8::Object::New(isolate);
                 v8::Local<v8::Object> module_obj = module.module.Get(isolate);
@@ -1079,6 +1235,7 @@ namespace jsb
                 // build the module tree
                 if (!p_parent_id.is_empty())
                 {
+                    module.add_dependent(p_parent_id);
                     if (const JavaScriptModule* parent_ptr = module_cache_.find(p_parent_id))
                     {
                         const v8::Local<v8::Object> parent_module = parent_ptr->module.Get(isolate);
@@ -1194,6 +1351,12 @@ namespace jsb
         const v8::Local<v8::Object> class_obj = class_info->js_class.Get(isolate);
         const v8::Local<v8::Value> prototype = class_obj->Get(context, jsb_name(this, prototype)).ToLocalChecked();
 
+        // unchanged (e.g. the module is not re-executed), do not touch the instance to keep the hidden class stable
+        if (instance->GetPrototype() == prototype)
+        {
+            return;
+        }
+
         const impl::TryCatch try_catch(isolate);
         jsb_check(instance->IsObject());
         jsb_check(prototype->IsObject());
@@ -1221,6 +1384,7 @@ namespace jsb
             require->Set(context, jsb_name(this, main), v8::Undefined(isolate_)).Check();
         }
         require->Set(context, jsb_name(this, cache), module_cache_.get_cache(isolate_)).Check();
+        require->Set(context, jsb_name(this, async), JSB_NEW_FUNCTION(context, Builtins::_require_async, /* magic: module_id */ module_id)).Check();
         return require;
     }
 
@@ -1229,6 +1393,7 @@ namespace jsb
     {
         JSB_BENCHMARK_SCOPE(JSRealm, load);
         this->check_internal_state();
+        flags_ |= EF_UserCode;
         v8::Isolate* isolate = get_isolate();
         v8::Isolate::Scope isolate_scope(isolate);
         v8::HandleScope handle_scope(isolate);
@@ -1328,6 +1493,7 @@ namespace jsb
     JSValueMove Environment::eval_source(const char* p_source, int p_length, const String& p_filename, Error& r_err)
     {
         JSB_BENCHMARK_SCOPE(JSRealm, eval_source);
+        flags_ |= EF_UserCode;
         v8::Isolate::Scope isolate_scope(isolate_);
         v8::HandleScope handle_scope(isolate_);
         const v8::Local<v8::Context> context = context_.Get(isolate_);
@@ -1373,28 +1539,7 @@ namespace jsb
     bool Environment::release_function(ObjectCacheID p_func_id)
     {
         this->check_internal_state();
-        if (function_bank_.is_valid_index(p_func_id))
-        {
-            TStrongRef<v8::Function>& strong_ref = function_bank_.get_value(p_func_id);
-            if (strong_ref.unref())
-            {
-                v8::Isolate* isolate = get_isolate();
-                v8::HandleScope handle_scope(isolate);
-                if (jsb_likely(!strong_ref.object_.IsEmpty()))
-                {
-                    const size_t r = function_refs_.erase(TWeakRef(isolate, strong_ref.object_));
-                    jsb_unused(r);
-                    jsb_check(r != 0);
-                }
-                else
-                {
-                    JSB_LOG(Verbose, "(not an error if Environment is disposing) try to release a function which has already been disposed %s", p_func_id);
-                }
-                function_bank_.remove_at_checked(p_func_id);
-            }
-            return true;
-        }
-        return false;
+        return function_registry_.release(p_func_id);
     }
 
     Variant Environment::_call(v8::Isolate* isolate, const v8::Local<v8::Context>& context, const v8::Local<v8::Function>& p_func, const v8::Local<v8::Value>& p_self, const Variant** p_args, int p_argcount, Callable::CallError& r_error)
@@ -1585,59 +1730,130 @@ namespace jsb
             return;
         }
 
-        // handle all @onready properties
-        v8::Local<v8::Value> val_test;
-        if (self->Get(context, jsb_symbol(this, ClassImplicitReadyFuncs)).ToLocal(&val_test) && val_test->IsArray())
+        // handle all @onready properties with the plan compiled on the first instance of the script class
+        Vector<ScriptOnReadyPlan::Field> fields;
+        v8::Local<v8::Array> collection;
         {
-            const v8::Local<v8::Array> collection = val_test.As<v8::Array>();
-            const uint32_t len = collection->Length();
-            const Node* node = (Node*)(Object*) unpacked;
-
-            for (uint32_t index = 0; index < len; ++index)
+            ScriptClassInfoPtr class_info = script_classes_.get_value_scoped(p_script_class_id);
+            if (!class_info->onready_plan.compiled)
             {
-                const v8::Local<v8::Object> element = collection->Get(context, index).ToLocalChecked().As<v8::Object>();
-                const v8::Local<v8::String> element_name = element->Get(context, jsb_name(this, name)).ToLocalChecked().As<v8::String>();
-                v8::Local<v8::Value> element_value = element->Get(context, jsb_name(this, evaluator)).ToLocalChecked();
+                _compile_onready_plan(context, self, class_info->onready_plan);
+            }
+            fields = class_info->onready_plan.fields;
+            if (!class_info->onready_plan.collection.IsEmpty())
+            {
+                collection = class_info->onready_plan.collection.Get(isolate);
+            }
+        }
+        const int len = fields.size();
+        if (len == 0)
+        {
+            return;
+        }
+
+        // resolve all nodes at once before crossing into JS
+        const Node* node = (Node*)(Object*) unpacked;
+        LocalVector<Node*> child_nodes;
+        child_nodes.resize(len);
+        for (int index = 0; index < len; ++index)
+        {
+            const NodePath& node_path = fields[index].node_path;
+            child_nodes[index] = node_path.is_empty() ? nullptr : node->get_node(node_path);
+        }
+
+        for (int index = 0; index < len; ++index)
+        {
+            const ScriptOnReadyPlan::Field& field = fields[index];
+            const v8::Local<v8::String> element_name = get_string_value(field.name);
 
-                if (element_value->IsString())
+            if (!field.node_path.is_empty())
+            {
+                Node* child_node = child_nodes[index];
+                if (!child_node)
                 {
-                    const String node_path_str = impl::Helper::to_string(isolate, element_value);
-                    Node* child_node = node->get_node(node_path_str);
-                    if (!child_node)
-                    {
-                        self->Set(context, element_name, v8::Null(isolate)).Check();
-                        return;
-                    }
-                    v8::Local<v8::Object> child_object;
-                    if (!TypeConvert::gd_obj_to_js(isolate, context, child_node, child_object))
-                    {
-                        JSB_LOG(Error, "failed to evaluate onready value for %s", node_path_str);
-                        return;
-                    }
-                    self->Set(context, element_name, child_object).Check();
+                    self->Set(context, element_name, v8::Null(isolate)).Check();
+                    continue;
                 }
-                else if (element_value->IsFunction())
+                v8::Local<v8::Object> child_object;
+                if (!TypeConvert::gd_obj_to_js(isolate, context, child_node, child_object))
                 {
-                    jsb_not_implemented(true, "function evaluator not implemented yet");
-                    v8::Local<v8::Value> argv[] = { self };
-                    const impl::TryCatch try_catch_run(isolate);
-                    v8::MaybeLocal<v8::Value> result = element_value.As<v8::Function>()->Call(context, self, std::size(argv), argv);
-                    if (try_catch_run.has_caught())
-                    {
-                        JSB_LOG(Warning, "something wrong when evaluating onready '%s'\n%s",
-                            impl::Helper::to_string(isolate, element_name),
-                            BridgeHelper::get_exception(try_catch_run));
-                        return;
-                    }
-                    if (!result.IsEmpty())
-                    {
-                        self->Set(context, element_name, result.ToLocalChecked()).Check();
-                    }
+                    JSB_LOG(Error, "failed to evaluate onready value for %s", (String) field.node_path);
+                    continue;
+                }
+                self->Set(context, element_name, child_object).Check();
+            }
+            else
+            {
+                jsb_not_implemented(true, "function evaluator not implemented yet");
+                jsb_check(!collection.IsEmpty());
+                const v8::Local<v8::Object> element = collection->Get(context, field.index).ToLocalChecked().As<v8::Object>();
+                const v8::Local<v8::Value> element_value = element->Get(context, jsb_name(this, evaluator)).ToLocalChecked();
+                if (!element_value->IsFunction()) continue;
+
+                v8::Local<v8::Value> argv[] = { self };
+                const impl::TryCatch try_catch_run(isolate);
+                v8::MaybeLocal<v8::Value> result = element_value.As<v8::Function>()->Call(context, self, std::size(argv), argv);
+                if (try_catch_run.has_caught())
+                {
+                    JSB_LOG(Warning, "something wrong when evaluating onready '%s'\n%s",
+                        field.name,
+                        BridgeHelper::get_exception(try_catch_run));
+                    return;
+                }
+                if (!result.IsEmpty())
+                {
+                    self->Set(context, element_name, result.ToLocalChecked()).Check();
                 }
             }
         }
     }
 
+    void Environment::_compile_onready_plan(const v8::Local<v8::Context>& p_context, const v8::Local<v8::Object>& p_self, ScriptOnReadyPlan& r_plan)
+    {
+        v8::Isolate* isolate = get_isolate();
+        r_plan.clear();
+        r_plan.compiled = true;
+
+        v8::Local<v8::Value> val_test;
+        if (!p_self->Get(p_context, jsb_symbol(this, ClassImplicitReadyFuncs)).ToLocal(&val_test) || !val_test->IsArray())
+        {
+            return;
+        }
+
+        const v8::Local<v8::Array> collection = val_test.As<v8::Array>();
+        const uint32_t len = collection->Length();
+        bool has_function_evaluator = false;
+        for (uint32_t index = 0; index < len; ++index)
+        {
+            const v8::Local<v8::Object> element = collection->Get(p_context, index).ToLocalChecked().As<v8::Object>();
+            const v8::Local<v8::String> element_name = element->Get(p_context, jsb_name(this, name)).ToLocalChecked().As<v8::String>();
+            const v8::Local<v8::Value> element_value = element->Get(p_context, jsb_name(this, evaluator)).ToLocalChecked();
+
+            ScriptOnReadyPlan::Field field;
+            field.name = get_string_name(element_name);
+            field.index = index;
+            if (element_value->IsString())
+            {
+                field.node_path = NodePath(impl::Helper::to_string(isolate, element_value));
+            }
+            else if (element_value->IsFunction())
+            {
+                has_function_evaluator = true;
+            }
+            else
+            {
+                JSB_LOG(Warning, "unsupported onready evaluator for %s", field.name);
+                continue;
+            }
+            r_plan.fields.append(field);
+        }
+        if (has_function_evaluator)
+        {
+            r_plan.collection.Reset(isolate, collection);
+        }
+        JSB_LOG(VeryVerbose, "onready plan compiled with %d fields", r_plan.fields.size());
+    }
+
     Variant Environment::call_script_method(ScriptClassID p_script_class_id, NativeObjectID p_object_id, const StringName& p_method, const Variant** p_argv, int p_argc, Callable::CallError& r_error)
     {
         // static calls are not supported
@@ -1648,6 +1864,7 @@ namespace jsb
             r_error.error = Callable::CallError::CALL_ERROR_INVALID_METHOD;
             return {};
         }
+        JSB_BRIDGE_COUNTER_INC(this, ScriptMethodCall);
 
         v8::Isolate* isolate = get_isolate();
         v8::Isolate::Scope isolate_scope(isolate);
@@ -1705,7 +1922,7 @@ namespace jsb
     Variant Environment::call_function(void* p_pointer, ObjectCacheID p_func_id, const Variant** p_args, int p_argcount, Callable::CallError& r_error)
     {
         this->check_internal_state();
-        if (!function_bank_.is_valid_index(p_func_id))
+        if (!function_registry_.is_valid(p_func_id))
         {
             r_error.error = Callable::CallError::CALL_ERROR_INVALID_METHOD;
             return {};
@@ -1729,16 +1946,45 @@ namespace jsb
                 r_error.error = Callable::CallError::CALL_ERROR_INVALID_METHOD;
                 return {};
             }
-            const TStrongRef<v8::Function>& js_func = function_bank_.get_value(p_func_id);
-            jsb_check(js_func);
-            return _call(isolate, context, js_func.object_.Get(isolate), self, p_args, p_argcount, r_error);
+            return _call(isolate, context, function_registry_.get(isolate, p_func_id), self, p_args, p_argcount, r_error);
         }
 
         // if pointer is nullptr, we just call the func with `this` as undefined (a dead object),
         // let JS throw an error if the function is actually not expected to be called without `this`
-        const TStrongRef<v8::Function>& js_func = function_bank_.get_value(p_func_id);
-        jsb_check(js_func);
-        return _call(isolate, context, js_func.object_.Get(isolate), v8::Undefined(isolate), p_args, p_argcount, r_error);
+        return _call(isolate, context, function_registry_.get(isolate, p_func_id), v8::Undefined(isolate), p_args, p_argcount, r_error);
+    }
+
+    bool Environment::call_function(const v8::Local<v8::Context>& p_context, void* p_pointer, ObjectCacheID p_func_id, int p_argc, v8::Local<v8::Value>* p_argv)
+    {
+        this->check_internal_state();
+        if (!function_registry_.is_valid(p_func_id))
+        {
+            return false;
+        }
+
+        v8::Isolate* isolate = get_isolate();
+        v8::Local<v8::Value> self = v8::Undefined(isolate);
+        if (p_pointer)
+        {
+            v8::Local<v8::Object> obj;
+            if (!this->try_get_object(p_pointer, obj))
+            {
+                JSB_LOG(Error, "invalid `this` for calling function");
+                return false;
+            }
+            self = obj;
+        }
+
+        const v8::Local<v8::Function> js_func = function_registry_.get(isolate, p_func_id);
+        const impl::TryCatch try_catch_run(isolate);
+        const v8::MaybeLocal<v8::Value> rval = js_func->Call(p_context, self, p_argc, p_argv);
+        jsb_unused(rval);
+        if (try_catch_run.has_caught())
+        {
+            JSB_LOG(Error, "exception thrown in function:\n%s", BridgeHelper::get_exception(try_catch_run));
+            return false;
+        }
+        return true;
     }
 
     void Environment::transfer_object(Environment* p_from, Environment* p_to, NativeObjectID p_worker_handle_id, const Variant& p_target)
@@ -1775,6 +2021,7 @@ namespace jsb
     void Environment::_on_gc_request()
     {
         string_name_cache_.clear();
+        string_value_cache_.clear();
         source_map_cache_.clear();
 
 #if JSB_EXPOSE_GC_FOR_TESTING
@@ -10,11 +10,15 @@
 #include "jsb_value_move.h"
 #include "jsb_statistics.h"
 #include "jsb_timer_tags.h"
+#include "jsb_memory_budget.h"
 #include "jsb_timer_action.h"
+#include "jsb_function_registry.h"
 #include "jsb_object_handle.h"
 #include "jsb_module_loader.h"
 #include "jsb_module_resolver.h"
+#include "jsb_module_fetcher.h"
 #include "jsb_string_name_cache.h"
+#include "jsb_string_value_cache.h"
 #include "jsb_array_buffer_allocator.h"
 #include "../internal/jsb_internal.h"
 
@@ -55,6 +59,8 @@ namespace jsb
         virtual ~TransferData() = default;
     };
 
+    class EnvironmentHandle;
+
     // Environment it-self is NOT thread-safe.
     class Environment : public std::enable_shared_from_this<Environment>
     {
@@ -101,12 +107,15 @@ namespace jsb
             EF_PreDispose = 1 << 1,
             EF_PostDispose = 1 << 2,
             EF_Worker = 1 << 3,
+            EF_MemoryExceeded = 1 << 4,
+            EF_UserCode = 1 << 5,
         };
 
         friend class Builtins;
         friend struct InstanceBindingCallbacks;
         friend struct ClassRegister;
         friend struct EnvironmentStore;
+        friend class ModuleFetcher;
 
         //TODO remove this later
         friend struct ScriptClassInfo;
@@ -122,6 +131,13 @@ namespace jsb
 
         ArrayBufferAllocator allocator_;
 
+        MemoryBudget memory_budget_;
+        MemoryPressureLevel::Type memory_pressure_level_ = MemoryPressureLevel::None;
+        uint64_t last_memory_gc_msec_ = 0;
+
+        // called on the memory pressure level changed (set by `jsb.memory.set_pressure_callback`)
+        v8::Global<v8::Function> memory_pressure_callback_;
+
         internal::DoubleBuffered<Message> inbox_;
 
 #if JSB_THREADING
@@ -140,11 +156,13 @@ namespace jsb
         internal::SArray<ScriptClassInfo, ScriptClassID> script_classes_;
 
         StringNameCache string_name_cache_;
+        StringValueCache string_value_cache_;
 
         ObjectDB object_db_;
         HashSet<void*> persistent_objects_;
 
         internal::VariantAllocator variant_allocator_;
+        BridgeCounters bridge_counters_;
 
         // module_id => loader
         HashMap<StringName, class IModuleLoader*> module_loaders_;
@@ -158,18 +176,27 @@ namespace jsb
         // EnvironmentFlags
         uint32_t flags_ = EF_None;
 
+        // set while registered in the environment store
+        SafeFlag alive_;
+
 #if JSB_WITH_DEBUGGER
         JavaScriptDebugger debugger_;
 #endif
 
         internal::SourceMapCache source_map_cache_;
 
+        // null if async logging is disabled
+        std::shared_ptr<internal::LogQueue> log_queue_;
+
         internal::CFunctionPointers function_pointers_;
 
         JavaScriptModuleCache module_cache_;
 
-        internal::TypeGen<TWeakRef<v8::Function>, internal::Index32>::UnorderedMap function_refs_; // backlink
-        internal::SArray<TStrongRef<v8::Function>, internal::Index32> function_bank_;
+        // modules loaded asynchronously
+        ModuleFetcher module_fetcher_;
+
+        // functions referenced by JSCallables
+        FunctionRegistry function_registry_;
 
         struct DeferredClassRegister
         {
@@ -207,6 +234,9 @@ namespace jsb
 
             Thread::ID thread_id = 0;
             Type type = Type::Default;
+
+            // memory limits of this environment (unlimited by default)
+            MemoryBudget memory_budget;
         };
 
         Environment(const CreateParams& p_params);
@@ -240,6 +270,12 @@ namespace jsb
         jsb_force_inline v8::Local<v8::Context> get_context() const { return context_.Get(isolate_); }
         jsb_force_inline EnvironmentID id() const { return (EnvironmentID) this; }
 
+        // [thread safe] whether it's still registered (not disposed yet), without the lock of the environment store
+        jsb_force_inline bool is_alive() const { return alive_.is_set(); }
+
+        // a reference to this environment which can be resolved from any thread without the lock of the environment store
+        EnvironmentHandle get_handle();
+
         jsb_force_inline internal::VariantInfoCollection& get_variant_info_collection() { return variant_info_collection_; }
 
         void add_class_register(const Variant::Type p_type, const ClassRegisterFunc p_func)
@@ -267,6 +303,11 @@ namespace jsb
         bool release_function(ObjectCacheID p_func_id);
         Variant call_function(void* p_pointer, ObjectCacheID p_func_id, const Variant **p_args, int p_argcount, Callable::CallError &r_error);
 
+        // call a function with javascript arguments directly (without the Variant translation), the return value is discarded.
+        // exceptions thrown by the function are caught and logged as `call_function` does.
+        // NOTE: it must be called in the scope of the isolate and the context
+        bool call_function(const v8::Local<v8::Context>& p_context, void* p_pointer, ObjectCacheID p_func_id, int p_argc, v8::Local<v8::Value>* p_argv);
+
         /**
          * This method will not throw any JS exception.
          */
@@ -338,11 +379,14 @@ namespace jsb
         // manually scan changes of modules,
         // will reload IMMEDIATELY
         // (modules not attached with GodotJS script are not automatically reloaded by resource manager)
-        void scan_external_changes();
+        // the script modules depending on the changed ones are only marked as reloading, and returned in `r_script_dependents`
+        // (the scripts must be invalidated to reload them, see `GodotJSScript::invalidate_dependent_scripts`).
+        void scan_external_changes(Vector<StringName>* r_script_dependents = nullptr);
 
         // request to reload a module,
         // will reload until next load.
-        ModuleReloadResult::Type mark_as_reloading(const StringName& p_name);
+        // all modules depending on it are also requested to reload, and returned in `r_dependents` if provided.
+        ModuleReloadResult::Type mark_as_reloading(const StringName& p_name, Vector<StringName>* r_dependents = nullptr);
 
         void start_debugger(uint16_t p_port);
 
@@ -356,11 +400,13 @@ namespace jsb
         }
 
         jsb_force_inline internal::SourceMapCache& get_source_map_cache() { return source_map_cache_; }
+        jsb_force_inline internal::LogQueue* get_log_queue() const { return log_queue_.get(); }
+        jsb_force_inline BridgeCounters& get_bridge_counters() { return bridge_counters_; }
 
         jsb_force_inline void notify_microtasks_run() { flags_ |= EF_MicrotaskCheckpoint; }
 
-        jsb_force_inline Variant* alloc_variant(const Variant& p_templet) { jsb_check(p_templet.get_type() != Variant::OBJECT); return variant_allocator_.alloc(p_templet); }
-        jsb_force_inline Variant* alloc_variant() { return variant_allocator_.alloc(); }
+        jsb_force_inline Variant* alloc_variant(const Variant& p_templet) { jsb_check(p_templet.get_type() != Variant::OBJECT); JSB_BRIDGE_COUNTER_INC(this, VariantAlloc); return variant_allocator_.alloc(p_templet); }
+        jsb_force_inline Variant* alloc_variant() { JSB_BRIDGE_COUNTER_INC(this, VariantAlloc); return variant_allocator_.alloc(); }
         jsb_force_inline void dealloc_variant(Variant* p_var) { variant_allocator_.free(p_var); }
 
 #if JSB_WITH_ESSENTIALS
@@ -369,6 +415,8 @@ namespace jsb
 #endif
 
         jsb_force_inline StringNameCache& get_string_name_cache() { return string_name_cache_; }
+        jsb_force_inline StringValueCache& get_string_value_cache() { return string_value_cache_; }
+        jsb_force_inline ModuleFetcher& get_module_fetcher() { return module_fetcher_; }
         jsb_force_inline v8::Local<v8::String> get_string_value(const StringName& p_name) { return string_name_cache_.get_string_value(isolate_, p_name); }
         jsb_force_inline StringName get_string_name(const v8::Local<v8::String>& p_value) { return string_name_cache_.get_string_name(isolate_, p_value); }
 
@@ -440,6 +488,30 @@ namespace jsb
 
         void update(uint64_t p_delta_msecs);
 
+        // release the transient states (pending async calls, microtasks and caches) before reusing a pooled shadow environment.
+        // it can not reset the global object, module cache and script classes, see `has_run_user_code`.
+        void recycle();
+
+        // any user module or source has been loaded/evaluated (not only the internal bundles),
+        // the environment is not clean anymore and should not be reused by others.
+        jsb_force_inline bool has_run_user_code() const { return flags_ & EF_UserCode; }
+
+        jsb_force_inline const MemoryBudget& get_memory_budget() const { return memory_budget_; }
+        jsb_force_inline MemoryPressureLevel::Type get_memory_pressure_level() const { return memory_pressure_level_; }
+        jsb_force_inline size_t get_memory_used() const { return impl::Helper::get_memory_used(isolate_); }
+
+        // the hard memory limit is hit, a worker will be terminated (see `WorkerImpl::_run`)
+        jsb_force_inline bool is_memory_exceeded() const { return flags_ & EF_MemoryExceeded; }
+
+        // remove the hard limit from the underlying runtime, to allow the environment to report errors and be disposed
+        void lift_memory_limit();
+
+        // update the memory pressure level, run gc at the soft limit, and notify the JS side if the level changed.
+        // it's called in `update`, call it explicitly if the environment is not updating.
+        void check_memory_budget();
+
+        void set_memory_pressure_callback(const v8::Local<v8::Function>& p_callback);
+
         // [thread safe] it's OK to call this method before the evn inited.
         void post_message(Message&& p_message)
         {
@@ -565,6 +637,9 @@ namespace jsb
          */
         void call_script_prelude(ScriptClassID p_script_class_id, NativeObjectID p_object_id);
 
+        // collect the `@onready` fields of a script class (from any instance of it) into a plan shared by all instances
+        void _compile_onready_plan(const v8::Local<v8::Context>& p_context, const v8::Local<v8::Object>& p_self, ScriptOnReadyPlan& r_plan);
+
         // callback from v8 gc (not 100% guaranteed called)
         jsb_force_inline static void object_gc_callback(const v8::WeakCallbackInfo<void>& info)
         {
@@ -612,6 +687,28 @@ namespace jsb
 
         void free_object(void* p_pointer, FinalizationType p_finalize);
     };
+
+    // A weak reference to an Environment for the objects which may be used from any thread (such as JSCallable).
+    // Resolving it only touches the atomic counters of the shared pointer (instead of locking the environment store),
+    // and it's never resolved as another Environment allocated at the same address.
+    class EnvironmentHandle
+    {
+    private:
+        std::weak_ptr<Environment> env_;
+
+    public:
+        EnvironmentHandle() = default;
+        explicit EnvironmentHandle(std::weak_ptr<Environment> p_env) : env_(std::move(p_env)) {}
+
+        // [thread safe] return null if the environment is already disposed
+        std::shared_ptr<Environment> lock() const
+        {
+            std::shared_ptr<Environment> env = env_.lock();
+            return env && env->is_alive() ? env : nullptr;
+        }
+    };
+
+    jsb_force_inline EnvironmentHandle Environment::get_handle() { return EnvironmentHandle(weak_from_this()); }
 }
 
 #endif
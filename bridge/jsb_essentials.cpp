@@ -22,6 +22,31 @@ namespace jsb
         }
     }
 
+    // capture the raw stack frames for logging (no error thrown).
+    // they are translated with source map in `LogEntry::resolve` when the entry is actually emitted (on the flush thread if buffered).
+    // only the top frame is captured if `p_stacktrace` is false (only the caller position wanted).
+    static void _capture_stacktrace(v8::Isolate* isolate, bool p_stacktrace, internal::LogEntry& r_entry)
+    {
+        const int max_depth = p_stacktrace ? MIN(internal::Settings::get_logger_max_stack_depth(), JSB_MAX_STACKTRACE_DEPTH) : 1;
+        r_entry.frames.resize(max_depth);
+        if (const int num = impl::Helper::capture_stack_frames(isolate, r_entry.frames.ptrw(), max_depth); num >= 0)
+        {
+            r_entry.frames.resize(num);
+            r_entry.with_stacktrace = p_stacktrace;
+            return;
+        }
+
+        // fallback to the stacktrace from a thrown error if not supported (translated immediately)
+        r_entry.frames.clear();
+        String stacktrace;
+        _generate_stacktrace(isolate, stacktrace, r_entry.position);
+        if (p_stacktrace && !stacktrace.is_empty())
+        {
+            r_entry.text += "\n";
+            r_entry.text += stacktrace;
+        }
+    }
+
     template<internal::ELogSeverity::Type ActiveSeverity>
     void _print(const v8::FunctionCallbackInfo<v8::Value>& info)
     {
@@ -65,60 +90,38 @@ namespace jsb
             return;
         }
 
-        String stacktrace;
-        internal::SourcePosition source_position;
+        internal::LogEntry entry;
+        entry.severity = ActiveSeverity;
+        entry.text = sb.as_string();
 
-        if constexpr (ActiveSeverity >= internal::ELogSeverity::Trace)
+        if constexpr (ActiveSeverity == internal::ELogSeverity::Trace)
         {
-            _generate_stacktrace(isolate, stacktrace, source_position);
+            _capture_stacktrace(isolate, true, entry);
         }
-
-        if constexpr (ActiveSeverity == internal::ELogSeverity::Warning)
+        else if constexpr (ActiveSeverity > internal::ELogSeverity::Trace)
         {
-            const String text = sb.as_string();
-            const CharString func_str = source_position.function.utf8();
-            const CharString filename_str = source_position.filename.utf8();
-            const CharString text_str = text.utf8();
-
-            internal::IConsoleOutput::internal_write(ActiveSeverity, text);
-            _err_print_error(
-                func_str.get_data(), filename_str.get_data(), source_position.line,
-                text_str.get_data(),
-                false, ERR_HANDLER_WARNING);
-            return;
+            // warn/error only report the source position of the caller
+            _capture_stacktrace(isolate, false, entry);
         }
-        if constexpr (ActiveSeverity == internal::ELogSeverity::Error)
-        {
-            const String text = sb.as_string();
-            const CharString func_str = source_position.function.utf8();
-            const CharString filename_str = source_position.filename.utf8();
-            const CharString text_str = text.utf8();
 
-            internal::IConsoleOutput::internal_write(ActiveSeverity, text);
-            _err_print_error(
-                func_str.get_data(), filename_str.get_data(), source_position.line,
-                text_str.get_data(),
-                true, ERR_HANDLER_ERROR);
-            return;
-        }
-        if constexpr (ActiveSeverity == internal::ELogSeverity::Trace)
+        // write directly if async logging is disabled
+        Environment* env = Environment::wrap(isolate);
+        internal::LogQueue* log_queue = env->get_log_queue();
+        if (!log_queue)
         {
-            if (!stacktrace.is_empty())
-            {
-                sb.append("\n");
-                sb.append(stacktrace);
-            }
-            const String text = sb.as_string();
-            internal::IConsoleOutput::internal_write(ActiveSeverity, text);
-            print_line(text);
+            entry.resolve(&env->get_source_map_cache());
+            internal::LogEntry::emit(entry);
             return;
         }
 
-        // trivial prints
+        if constexpr (ActiveSeverity >= internal::ELogSeverity::Error)
+        {
+            // errors are never delayed (the process may crash soon after), but still in order with the buffered ones
+            log_queue->emit_sync(entry);
+        }
+        else
         {
-            const String text = sb.as_string();
-            internal::IConsoleOutput::internal_write(ActiveSeverity, text);
-            print_line(text);
+            log_queue->push(std::move(entry));
         }
     }
 
@@ -246,10 +249,6 @@ namespace jsb
             console_obj->Set(context, impl::Helper::new_string_ascii(isolate, "timeEnd"), JSB_NEW_FUNCTION(context, _time_end, {})).Check();
         }
 
-        //TODO the root 'import' function (async module loading?)
-        {
-        }
-
         // essential timer support
         {
             self->Set(context, impl::Helper::new_string_ascii(isolate, "setInterval"), JSB_NEW_FUNCTION(context, _set_timer<InternalTimerType::Interval>, {})).Check();
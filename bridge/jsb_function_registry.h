@@ -0,0 +1,154 @@
+#ifndef GODOTJS_FUNCTION_REGISTRY_H
+#define GODOTJS_FUNCTION_REGISTRY_H
+#include "jsb_bridge_pch.h"
+
+namespace jsb
+{
+    // The JS functions kept alive for the JSCallables of an Environment.
+    // A function registered repeatedly (e.g. a method connected to many signals) shares one slot with a reference count.
+    // Slots are recycled, the revision in the ID (see `internal::SArray`) tags the generation of a slot,
+    // so the ID held by a stale JSCallable fails the validation instead of resolving to the function now in the recycled slot.
+    // Functions are looked up through chains of slots with the same identity hash, no weak handles are kept for the backlinks.
+    class FunctionRegistry
+    {
+    public:
+        struct Stats
+        {
+            // num of slots in use, and the highest num since the Environment created
+            uint32_t live = 0;
+            uint32_t peak = 0;
+
+            // num of registrations, and the ones resolved to an existing slot
+            uint64_t registrations = 0;
+            uint64_t dedup_hits = 0;
+        };
+
+    private:
+        struct Slot
+        {
+            int hash = 0;
+            int ref_count = 0;
+
+            // the next slot with the same identity hash
+            ObjectCacheID next;
+
+            v8::Global<v8::Function> function;
+
+            Slot() = default;
+            Slot(const Slot&) = delete;
+            Slot& operator=(const Slot&) = delete;
+            Slot(Slot&&) noexcept = default;
+            Slot& operator=(Slot&&) noexcept = default;
+            ~Slot() = default;
+        };
+
+        internal::SArray<Slot, internal::Index32> slots_;
+
+        // identity hash => the first slot of the chain
+        HashMap<int, ObjectCacheID> heads_;
+
+        Stats stats_;
+
+    public:
+        jsb_force_inline const Stats& get_stats() const { return stats_; }
+
+        jsb_force_inline bool is_valid(const ObjectCacheID& p_id) const { return slots_.is_valid_index(p_id); }
+
+        // the function must be valid (see `is_valid`)
+        jsb_force_inline v8::Local<v8::Function> get(v8::Isolate* isolate, const ObjectCacheID& p_id) const
+        {
+            const Slot& slot = slots_.get_value(p_id);
+            jsb_check(!slot.function.IsEmpty());
+            return slot.function.Get(isolate);
+        }
+
+        // register a function (or add a reference to the existing slot of it)
+        ObjectCacheID retain(v8::Isolate* isolate, const v8::Local<v8::Function>& p_func)
+        {
+            ++stats_.registrations;
+            const int hash = p_func->GetIdentityHash();
+            ObjectCacheID head;
+            if (const ObjectCacheID* it = heads_.getptr(hash))
+            {
+                head = *it;
+                for (ObjectCacheID id = head; id; )
+                {
+                    Slot& slot = slots_.get_value(id);
+                    if (slot.function.Get(isolate) == p_func)
+                    {
+                        jsb_check(slot.ref_count > 0);
+                        ++slot.ref_count;
+                        ++stats_.dedup_hits;
+                        return id;
+                    }
+                    id = slot.next;
+                }
+            }
+
+            Slot slot;
+            slot.hash = hash;
+            slot.ref_count = 1;
+            slot.next = head;
+            slot.function.Reset(isolate, p_func);
+            const ObjectCacheID id = slots_.add(std::move(slot));
+            heads_[hash] = id;
+            stats_.live = (uint32_t) slots_.size();
+            if (stats_.live > stats_.peak) stats_.peak = stats_.live;
+            return id;
+        }
+
+        // remove a reference, the slot is recycled if it's the last one.
+        // return false if the ID is stale.
+        bool release(const ObjectCacheID& p_id)
+        {
+            if (!slots_.is_valid_index(p_id))
+            {
+                return false;
+            }
+            Slot& slot = slots_.get_value(p_id);
+            jsb_check(slot.ref_count > 0);
+            if (--slot.ref_count != 0)
+            {
+                return true;
+            }
+
+            // unlink from the chain
+            const int hash = slot.hash;
+            const ObjectCacheID next = slot.next;
+            ObjectCacheID* head = heads_.getptr(hash);
+            jsb_check(head);
+            if (*head == p_id)
+            {
+                if (next) *head = next;
+                else heads_.erase(hash);
+            }
+            else
+            {
+                ObjectCacheID id = *head;
+                for (;;)
+                {
+                    Slot& prev = slots_.get_value(id);
+                    if (prev.next == p_id)
+                    {
+                        prev.next = next;
+                        break;
+                    }
+                    id = prev.next;
+                    jsb_check(id);
+                }
+            }
+            slots_.remove_at_checked(p_id);
+            stats_.live = (uint32_t) slots_.size();
+            return true;
+        }
+
+        // release all functions no matter how many references they have (the peak is kept)
+        void clear()
+        {
+            heads_.clear();
+            while (!slots_.is_empty()) slots_.remove_last();
+            stats_.live = 0;
+        }
+    };
+}
+#endif
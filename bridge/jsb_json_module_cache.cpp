@@ -0,0 +1,133 @@
+#include "jsb_json_module_cache.h"
+
+namespace jsb
+{
+    namespace
+    {
+        struct JsonModuleCacheEntry
+        {
+            size_t len = 0;
+            uint32_t hash = 0;
+            Vector<uint8_t> data;
+            uint64_t last_access = 0;
+        };
+
+        struct JsonModuleCacheState
+        {
+            BinaryMutex lock;
+            HashMap<String, JsonModuleCacheEntry> entries;
+            uint64_t bytes = 0;
+            uint64_t tick = 0;
+
+            uint64_t hits = 0;
+            uint64_t misses = 0;
+            uint64_t evicted = 0;
+        };
+
+        JsonModuleCacheState& get_state()
+        {
+            static JsonModuleCacheState state;
+            return state;
+        }
+
+        // evict the least recently used entries until the budget is satisfied (the entry `p_keep` is never evicted)
+        void evict_locked(JsonModuleCacheState& p_state, const String& p_keep)
+        {
+            while (p_state.bytes > JSB_JSON_MODULE_CACHE_BUDGET)
+            {
+                const KeyValue<String, JsonModuleCacheEntry>* lru = nullptr;
+                for (const KeyValue<String, JsonModuleCacheEntry>& kv : p_state.entries)
+                {
+                    if (kv.key == p_keep) continue;
+                    if (!lru || kv.value.last_access < lru->value.last_access) lru = &kv;
+                }
+                if (!lru)
+                {
+                    break;
+                }
+                p_state.bytes -= lru->value.data.size();
+                ++p_state.evicted;
+                p_state.entries.erase(lru->key);
+            }
+        }
+
+        void store_locked(JsonModuleCacheState& p_state, const String& p_asset_path, size_t p_len, uint32_t p_hash, const Vector<uint8_t>& p_data)
+        {
+            if (const JsonModuleCacheEntry* entry = p_state.entries.getptr(p_asset_path))
+            {
+                p_state.bytes -= entry->data.size();
+            }
+            p_state.entries[p_asset_path] = { p_len, p_hash, p_data, ++p_state.tick };
+            p_state.bytes += p_data.size();
+            evict_locked(p_state, p_asset_path);
+
+            // too large to keep
+            if (p_state.bytes > JSB_JSON_MODULE_CACHE_BUDGET)
+            {
+                p_state.bytes -= p_data.size();
+                p_state.entries.erase(p_asset_path);
+            }
+        }
+    }
+
+    v8::MaybeLocal<v8::Value> JsonModuleCache::parse(v8::Isolate* isolate, const v8::Local<v8::Context>& p_context, const String& p_asset_path, const uint8_t* p_ptr, size_t p_len)
+    {
+#if JSB_WITH_JSON_MODULE_CACHE
+        JsonModuleCacheState& state = get_state();
+
+        // much cheaper than parsing, it also covers the files changed without a new modified time
+        jsb_check((size_t)(int) p_len == p_len);
+        const uint32_t hash = hash_murmur3_buffer(p_ptr, (int) p_len);
+
+        // copy-on-write, it's cheap to copy and safe to read without holding the lock
+        Vector<uint8_t> data;
+        {
+            MutexLock lock(state.lock);
+            if (JsonModuleCacheEntry* entry = state.entries.getptr(p_asset_path); entry && entry->len == p_len && entry->hash == hash)
+            {
+                entry->last_access = ++state.tick;
+                data = entry->data;
+            }
+        }
+
+        const bool hit = !data.is_empty();
+        const v8::MaybeLocal<v8::Value> rval = impl::Helper::parse_json_cached(isolate, p_context, p_ptr, p_len, data);
+        {
+            MutexLock lock(state.lock);
+            if (hit) ++state.hits;
+            else ++state.misses;
+
+            // the cache may be regenerated if it's rejected by the runtime
+            if (!data.is_empty())
+            {
+                store_locked(state, p_asset_path, p_len, hash, data);
+            }
+        }
+        JSB_LOG(Verbose, "json module %s (cache %s, %d bytes)", p_asset_path, hit ? "hit" : "miss", data.size());
+        return rval;
+#else
+        return impl::Helper::parse_json(isolate, p_context, p_ptr, p_len);
+#endif
+    }
+
+    JsonModuleCache::Stats JsonModuleCache::get_stats()
+    {
+        JsonModuleCacheState& state = get_state();
+        MutexLock lock(state.lock);
+        Stats stats;
+        stats.entries = state.entries.size();
+        stats.bytes = (int64_t) state.bytes;
+        stats.hits = state.hits;
+        stats.misses = state.misses;
+        stats.evicted = state.evicted;
+        return stats;
+    }
+
+    void JsonModuleCache::clear()
+    {
+        JsonModuleCacheState& state = get_state();
+        MutexLock lock(state.lock);
+        state.entries.clear();
+        state.bytes = 0;
+    }
+}
@@ -0,0 +1,32 @@
+#ifndef GODOTJS_JSON_MODULE_CACHE_H
+#define GODOTJS_JSON_MODULE_CACHE_H
+#include "jsb_bridge_pch.h"
+
+namespace jsb
+{
+    // Process-wide cache of the parsed JSON modules (large data tables are usually required by all environments).
+    // The first Environment parses the source and keeps the value in a serialized form (only in QuickJS),
+    // the following ones (workers, shadow environments) read the value from it without parsing.
+    // Entries are identified by the asset path, and validated with the length and hash of the content.
+    // The total size of the entries is limited by `JSB_JSON_MODULE_CACHE_BUDGET`.
+    class JsonModuleCache
+    {
+    public:
+        struct Stats
+        {
+            int entries = 0;
+            int64_t bytes = 0;
+            uint64_t hits = 0;
+            uint64_t misses = 0;
+            uint64_t evicted = 0;
+        };
+
+        // [thread safe] parse the JSON source (zero-terminated), or read it from the cache
+        static v8::MaybeLocal<v8::Value> parse(v8::Isolate* isolate, const v8::Local<v8::Context>& p_context, const String& p_asset_path, const uint8_t* p_ptr, size_t p_len);
+
+        static Stats get_stats();
+        static void clear();
+    };
+}
+
+#endif
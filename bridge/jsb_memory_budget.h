@@ -0,0 +1,58 @@
+#ifndef GODOTJS_MEMORY_BUDGET_H
+#define GODOTJS_MEMORY_BUDGET_H
+
+#include "jsb_bridge_pch.h"
+
+namespace jsb
+{
+    namespace MemoryPressureLevel
+    {
+        enum Type : uint8_t
+        {
+            None,
+
+            // above `JSB_MEMORY_PRESSURE_MODERATE_PERCENT` of the soft limit
+            Moderate,
+
+            // above the soft limit (even after the automatic GC)
+            Critical,
+
+            // the hard limit is hit, allocations fail. workers are terminated.
+            Exceeded,
+        };
+
+        jsb_force_inline const char* get_name(Type p_level)
+        {
+            switch (p_level)
+            {
+            case None: return "none";
+            case Moderate: return "moderate";
+            case Critical: return "critical";
+            case Exceeded: return "exceeded";
+            default: return "unknown";
+            }
+        }
+    }
+
+    // Memory limits (in bytes) of an Environment, zero for unlimited.
+    struct MemoryBudget
+    {
+        uint64_t soft_limit = 0;
+        uint64_t hard_limit = 0;
+
+        jsb_force_inline bool is_limited() const { return soft_limit != 0 || hard_limit != 0; }
+
+        MemoryPressureLevel::Type get_level(uint64_t p_used) const
+        {
+            if (hard_limit != 0 && p_used >= hard_limit) return MemoryPressureLevel::Exceeded;
+            if (soft_limit != 0)
+            {
+                if (p_used >= soft_limit) return MemoryPressureLevel::Critical;
+                if (p_used >= soft_limit / 100 * JSB_MEMORY_PRESSURE_MODERATE_PERCENT) return MemoryPressureLevel::Moderate;
+            }
+            return MemoryPressureLevel::None;
+        }
+    };
+}
+
+#endif
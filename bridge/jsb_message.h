@@ -18,7 +18,7 @@ namespace jsb
             // worker message
             TYPE_MESSAGE,
 
-            //TODO worker error (NOT IMPLEMENTED YET)
+            // worker error (the worker is terminated due to the memory limit)
             TYPE_ERROR,
         };
 
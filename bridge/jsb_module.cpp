@@ -20,25 +20,51 @@ namespace jsb
 #if JSB_SUPPORT_RELOAD && defined(TOOLS_ENABLED)
         if (!is_reloadable()) return false;
 
-        //TODO reload all related modules (search the module graph) ?
         //TODO inconsistent implementation, since the original time modified is read in module resolvers (SourceReader)
         const uint64_t latest_time = FileAccess::get_modified_time(source_info.source_filepath);
-        if (latest_time && latest_time != time_modified)
+        if (!latest_time || latest_time == time_modified)
         {
-            time_modified = latest_time;
+            return false;
+        }
+        time_modified = latest_time;
 
-            const String latest_hash = FileAccess::get_md5(source_info.source_filepath);
-            if (!latest_hash.is_empty() && latest_hash != hash)
-            {
-                hash = latest_hash;
-                reload_requested = true;
-                return true;
-            }
+        // a different size is definitely a change, no need to hash it (the hash will be updated on reloading)
+        const Ref<FileAccess> file = FileAccess::open(source_info.source_filepath, FileAccess::READ);
+        if (file.is_null())
+        {
+            return false;
+        }
+        const uint64_t latest_size = file->get_length();
+        if (latest_size != file_size)
+        {
+            file_size = latest_size;
+            reload_requested = true;
+            return true;
+        }
+
+        // touched but with the same size, compare the content
+        const String latest_hash = FileAccess::get_md5(source_info.source_filepath);
+        if (!latest_hash.is_empty() && latest_hash != hash)
+        {
+            hash = latest_hash;
+            reload_requested = true;
+            return true;
         }
 #endif
         return false;
     }
 
+    bool JavaScriptModule::mark_as_dependent_reloading()
+    {
+#if JSB_SUPPORT_RELOAD && defined(TOOLS_ENABLED)
+        if (!is_reloadable() || reload_requested) return false;
+        reload_requested = true;
+        return true;
+#else
+        return false;
+#endif
+    }
+
     void JavaScriptModule::mark_as_reloaded()
     {
 #if JSB_SUPPORT_RELOAD && defined(TOOLS_ENABLED)
@@ -78,4 +104,30 @@ namespace jsb
         return *module;
     }
 
+    void JavaScriptModuleCache::collect_dependents(const StringName& p_name, Vector<StringName>& r_dependents) const
+    {
+#if JSB_SUPPORT_RELOAD && defined(TOOLS_ENABLED)
+        // breadth first, so that the dependents closer to the changed module come first
+        HashSet<StringName> visited;
+        visited.insert(p_name);
+        const JavaScriptModule* module = find(p_name);
+        for (int index = r_dependents.size(); module; )
+        {
+            for (const StringName& dependent : module->dependents)
+            {
+                if (visited.has(dependent)) continue;
+                visited.insert(dependent);
+                r_dependents.append(dependent);
+            }
+
+            // skip the dependents not found (should not happen unless the module cache is modified manually)
+            module = nullptr;
+            while (!module && index < r_dependents.size())
+            {
+                module = find(r_dependents[index++]);
+            }
+        }
+#endif
+    }
+
 }
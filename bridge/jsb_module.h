@@ -43,19 +43,34 @@ namespace jsb
 #if JSB_SUPPORT_RELOAD && defined(TOOLS_ENABLED)
         bool reload_requested = false;
         uint64_t time_modified = 0;
+        uint64_t file_size = 0;
         String hash;
 
+        // modules which have required this module (the reverse edges of `children`).
+        // edges are never removed on reloading, a stale one only costs an unnecessary re-execution.
+        Vector<StringName> dependents;
+
         jsb_force_inline bool is_loaded() const { return !reload_requested; }
 
         // can't reload modules if it's time_modified is unknown or non-file modules
         bool is_reloadable() const { return time_modified != 0 && !source_info.source_filepath.is_empty(); }
+
+        jsb_force_inline void add_dependent(const StringName& p_parent_id)
+        {
+            if (p_parent_id != id && !dependents.has(p_parent_id)) dependents.append(p_parent_id);
+        }
 #else
         jsb_force_inline constexpr bool is_loaded() const { return true; }
         jsb_force_inline constexpr bool is_reloadable() const { return false; }
+        jsb_force_inline void add_dependent(const StringName& p_parent_id) {}
 #endif
 
         void on_load(v8::Isolate* isolate, const v8::Local<v8::Context>& context);
+
+        // check the source file for changes, the content hash is only computed if the modified time changed but the size not
         bool mark_as_reloading();
+        // request to reload without checking the source file (a module it depends on has been changed)
+        bool mark_as_dependent_reloading();
         void mark_as_reloaded();
 
     };
@@ -97,6 +112,10 @@ namespace jsb
             return it ? *it : nullptr;
         }
 
+        // collect all modules directly or indirectly depending on the given module (the module itself excluded),
+        // they are the minimal set of modules to re-execute after the given module changed.
+        void collect_dependents(const StringName& p_name, Vector<StringName>& r_dependents) const;
+
         jsb_force_inline JavaScriptModule* get_main() const
         {
             return find(main_);
@@ -0,0 +1,290 @@
+#include "jsb_module_fetcher.h"
+#include "jsb_environment.h"
+#include "jsb_module_resolver.h"
+
+#include "../internal/jsb_path_util.h"
+
+namespace jsb
+{
+    ModuleFetcher::~ModuleFetcher()
+    {
+        clear();
+    }
+
+    ModuleFetcher::Stats ModuleFetcher::get_stats() const
+    {
+        Stats stats = stats_;
+        stats.pending_requests = (uint32_t) requests_.size();
+        return stats;
+    }
+
+    void ModuleFetcher::clear()
+    {
+        requests_.clear();
+        entries_.clear();
+        deferred_.Reset();
+    }
+
+    v8::MaybeLocal<v8::Value> ModuleFetcher::fetch(Environment* p_env, const String& p_parent_id, const String& p_module_id)
+    {
+        v8::Isolate* isolate = p_env->get_isolate();
+        const v8::Local<v8::Context> context = isolate->GetCurrentContext();
+
+        if (deferred_.IsEmpty())
+        {
+            static constexpr char kSource[] = "(function () { let resolve, reject; const promise = new Promise(function (a, b) { resolve = a; reject = function (message) { b(new Error(message)); }; }); return [promise, resolve, reject]; })";
+            v8::Local<v8::Value> func;
+            if (!impl::Helper::compile_function(context, kSource, (int) ::std::size(kSource) - 1, String()).ToLocal(&func) || !func->IsFunction())
+            {
+                return {};
+            }
+            deferred_.Reset(isolate, func.As<v8::Function>());
+        }
+
+        v8::Local<v8::Value> rval;
+        if (!deferred_.Get(isolate)->Call(context, v8::Undefined(isolate), 0, nullptr).ToLocal(&rval) || !rval->IsArray())
+        {
+            return {};
+        }
+        const v8::Local<v8::Array> deferred = rval.As<v8::Array>();
+        v8::Local<v8::Value> promise, resolve, reject;
+        if (!deferred->Get(context, 0u).ToLocal(&promise)
+            || !deferred->Get(context, 1u).ToLocal(&resolve)
+            || !deferred->Get(context, 2u).ToLocal(&reject))
+        {
+            return {};
+        }
+
+        Request request;
+        request.parent_id = p_parent_id;
+        request.module_id = p_module_id;
+        request.resolve.Reset(isolate, resolve.As<v8::Function>());
+        request.reject.Reset(isolate, reject.As<v8::Function>());
+
+        // the request is settled in the next update if nothing to fetch
+        if (_resolve(p_env, p_parent_id, p_module_id, request.path) && !entries_.has(request.path))
+        {
+            _start(request.path);
+        }
+        requests_.push_back(std::move(request));
+        return promise;
+    }
+
+    void ModuleFetcher::update(Environment* p_env)
+    {
+        if (requests_.empty())
+        {
+            return;
+        }
+
+        Vector<String> arrived;
+        for (const KeyValue<String, Entry>& kv : entries_)
+        {
+            if (kv.value.state == EntryState::Reading && internal::FileManager::get_state(kv.key) != internal::FileManager::FileState::Pending)
+            {
+                arrived.push_back(kv.key);
+            }
+        }
+
+        for (const String& arrived_path : arrived)
+        {
+            // a memory lookup, unless it's evicted already (then it's read again here)
+            internal::FileContent content;
+            if (!internal::FileManager::read(arrived_path, content) || content.is_empty())
+            {
+                entries_.getptr(arrived_path)->state = EntryState::Failed;
+                continue;
+            }
+
+            ++stats_.fetched;
+            Vector<String> module_ids;
+            if (!arrived_path.ends_with("." JSB_JSON_EXT))
+            {
+                scan_dependencies((const char*) content.bytes.ptr(), (size_t) content.get_length(), module_ids);
+            }
+            Vector<String> dependencies;
+            for (const String& module_id : module_ids)
+            {
+                if (String path; _resolve(p_env, arrived_path, module_id, path) && !dependencies.has(path))
+                {
+                    dependencies.push_back(path);
+                }
+            }
+            Entry* entry = entries_.getptr(arrived_path);
+            entry->state = EntryState::Ready;
+            entry->dependencies = dependencies;
+
+            // expand the graph
+            for (const String& path : dependencies)
+            {
+                if (!entries_.has(path))
+                {
+                    _start(path);
+                }
+            }
+        }
+
+        v8::Isolate* isolate = p_env->get_isolate();
+        v8::Isolate::Scope isolate_scope(isolate);
+        v8::HandleScope handle_scope(isolate);
+        const v8::Local<v8::Context> context = p_env->get_context();
+        v8::Context::Scope context_scope(context);
+
+        // NOTE new requests may be added by the modules instantiated in `_settle`
+        for (size_t index = 0; index < requests_.size(); )
+        {
+            if (HashSet<String> visited; !requests_[index].path.is_empty() && !_is_fetched(requests_[index].path, visited))
+            {
+                ++index;
+                continue;
+            }
+            Request request = std::move(requests_[index]);
+            requests_.erase(requests_.begin() + (ptrdiff_t) index);
+            _settle(p_env, context, request);
+        }
+
+        // drop the sources fetched but not required
+        if (requests_.empty())
+        {
+            entries_.clear();
+        }
+    }
+
+    bool ModuleFetcher::prefetch(Environment* p_env, const String& p_module_id)
+    {
+        String path;
+        if (!_resolve(p_env, String(), p_module_id, path))
+        {
+            return false;
+        }
+        internal::FileManager::prefetch(path);
+        return true;
+    }
+
+    bool ModuleFetcher::_is_fetched(const String& p_path, HashSet<String>& p_visited) const
+    {
+        if (p_visited.has(p_path))
+        {
+            return true;
+        }
+        p_visited.insert(p_path);
+        const Entry* entry = entries_.getptr(p_path);
+        jsb_check(entry);
+        if (entry->state == EntryState::Reading)
+        {
+            return false;
+        }
+        for (const String& dependency : entry->dependencies)
+        {
+            if (!_is_fetched(dependency, p_visited))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    void ModuleFetcher::_settle(Environment* p_env, const v8::Local<v8::Context>& p_context, Request& p_request)
+    {
+        v8::Isolate* isolate = p_env->get_isolate();
+        v8::Local<v8::Value> argv[1];
+        bool succeeded = false;
+        {
+            const impl::TryCatch try_catch_run(isolate);
+            if (const JavaScriptModule* module = p_env->_load_module(p_request.parent_id, p_request.module_id))
+            {
+                argv[0] = module->exports.Get(isolate);
+                succeeded = true;
+            }
+            else
+            {
+                String message;
+                if (try_catch_run.has_caught()) try_catch_run.get_message(&message);
+                if (message.is_empty()) message = jsb_format("can not load module '%s'", p_request.module_id);
+                argv[0] = impl::Helper::new_string(isolate, message);
+            }
+        }
+
+        // the reactions of the promise run in microtasks, nothing to catch here
+        const v8::Local<v8::Function> func = (succeeded ? p_request.resolve : p_request.reject).Get(isolate);
+        const v8::MaybeLocal<v8::Value> rval = func->Call(p_context, v8::Undefined(isolate), 1, argv);
+        jsb_unused(rval);
+        p_env->notify_microtasks_run();
+    }
+
+    bool ModuleFetcher::_resolve(Environment* p_env, const String& p_parent_id, const String& p_module_id, String& r_path)
+    {
+        if (p_module_id.is_empty() || p_env->find_module_loader(p_module_id))
+        {
+            return false;
+        }
+
+        // same as `Environment::_load_module`
+        String normalized_id;
+        if (p_module_id.begins_with("./") || p_module_id.begins_with("../"))
+        {
+            const String combined_id = internal::PathUtil::combine(internal::PathUtil::dirname(p_parent_id), p_module_id);
+            if (internal::PathUtil::extract(combined_id, normalized_id) != OK || normalized_id.is_empty())
+            {
+                return false;
+            }
+        }
+        else
+        {
+            normalized_id = p_module_id;
+        }
+
+        ModuleSourceInfo source_info;
+        if (!p_env->find_module_resolver(normalized_id, source_info))
+        {
+            return false;
+        }
+        if (const JavaScriptModule* module = p_env->module_cache_.find(source_info.source_filepath); module && module->is_loaded())
+        {
+            return false;
+        }
+        r_path = source_info.source_filepath;
+        return true;
+    }
+
+    void ModuleFetcher::_start(const String& p_path)
+    {
+        entries_.insert(p_path, Entry());
+        internal::FileManager::prefetch(p_path);
+    }
+
+    void ModuleFetcher::scan_dependencies(const char* p_source, size_t p_len, Vector<String>& r_module_ids)
+    {
+        static constexpr char kRequire[] = "require";
+        static constexpr size_t kRequireLen = ::std::size(kRequire) - 1;
+
+        const auto is_attached = [](char c) { return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || c == '_' || c == '$' || c == '.'; };
+        const auto skip_spaces = [p_source, p_len](size_t& pos) { while (pos < p_len && (p_source[pos] == ' ' || p_source[pos] == '\t' || p_source[pos] == '\r' || p_source[pos] == '\n')) ++pos; };
+
+        for (size_t pos = 0; pos + kRequireLen < p_len; ++pos)
+        {
+            if (p_source[pos] != 'r' || memcmp(p_source + pos, kRequire, kRequireLen) != 0) continue;
+
+            // a standalone `require` (not `foo_require` or `obj.require`)
+            if (pos > 0 && is_attached(p_source[pos - 1])) continue;
+
+            size_t cur = pos + kRequireLen;
+            skip_spaces(cur);
+            if (cur >= p_len || p_source[cur] != '(') continue;
+            ++cur;
+            skip_spaces(cur);
+            if (cur >= p_len || (p_source[cur] != '"' && p_source[cur] != '\'')) continue;
+
+            const char quote = p_source[cur++];
+            const size_t begin = cur;
+            while (cur < p_len && p_source[cur] != quote && p_source[cur] != '\\' && p_source[cur] != '\n') ++cur;
+            if (cur >= p_len || p_source[cur] != quote || cur == begin) continue;
+            const size_t end = cur++;
+            skip_spaces(cur);
+            if (cur >= p_len || p_source[cur] != ')') continue;
+
+            r_module_ids.push_back(String::utf8(p_source + begin, (int) (end - begin)));
+            pos = cur;
+        }
+    }
+}
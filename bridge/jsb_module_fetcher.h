@@ -0,0 +1,95 @@
+#ifndef GODOTJS_MODULE_FETCHER_H
+#define GODOTJS_MODULE_FETCHER_H
+#include "jsb_bridge_pch.h"
+
+namespace jsb
+{
+    class Environment;
+
+    // Asynchronous module loading (`require.async(module_id)`, which returns a Promise of the module exports).
+    // The sources of the requested module and its static dependencies (`require` with a string literal) are prefetched
+    // by `internal::FileManager` in parallel, the dependency graph is expanded on the thread of the Environment as the sources arrive.
+    // Once the whole graph is fetched, the module is instantiated in `Environment::update`,
+    // and the resolver reads the sources from the cache of `internal::FileManager` instead of the files.
+    class ModuleFetcher
+    {
+    public:
+        struct Stats
+        {
+            // num of requests not settled yet
+            uint32_t pending_requests = 0;
+
+            // num of sources arrived
+            uint64_t fetched = 0;
+        };
+
+        ModuleFetcher() = default;
+        ~ModuleFetcher();
+
+        ModuleFetcher(const ModuleFetcher&) = delete;
+        ModuleFetcher& operator=(const ModuleFetcher&) = delete;
+
+        jsb_force_inline bool is_idle() const { return requests_.empty(); }
+        Stats get_stats() const;
+
+        // start loading a module, return a Promise of the module exports (empty if an exception is thrown)
+        v8::MaybeLocal<v8::Value> fetch(Environment* p_env, const String& p_parent_id, const String& p_module_id);
+
+        // expand the dependency graphs with the sources arrived, and settle the requests with the whole graph fetched
+        void update(Environment* p_env);
+
+        // prefetch the source of a module (not the dependencies) by `internal::FileManager`.
+        // return false if it's not necessary (already loaded, not resolvable or provided by a module loader).
+        static bool prefetch(Environment* p_env, const String& p_module_id);
+
+        // drop all requests (without settling them)
+        void clear();
+
+        // find the module ids in `require` calls with a string literal.
+        // it's a lightweight scan which does not skip comments, a false positive costs only an unnecessary read.
+        static void scan_dependencies(const char* p_source, size_t p_len, Vector<String>& r_module_ids);
+
+    private:
+        enum class EntryState : uint8_t
+        {
+            Reading,
+            Ready,
+            // not readable, the error is reported when the resolver reads it again
+            Failed,
+        };
+
+        struct Entry
+        {
+            EntryState state = EntryState::Reading;
+
+            // asset paths of the dependencies to fetch
+            Vector<String> dependencies;
+        };
+
+        struct Request
+        {
+            String parent_id;
+            String module_id;
+
+            // empty if nothing to fetch (already loaded, not resolvable or provided by a module loader)
+            String path;
+
+            v8::Global<v8::Function> resolve;
+            v8::Global<v8::Function> reject;
+        };
+
+        // get the asset path of a module to fetch, return false if not necessary
+        static bool _resolve(Environment* p_env, const String& p_parent_id, const String& p_module_id, String& r_path);
+
+        void _start(const String& p_path);
+        bool _is_fetched(const String& p_path, HashSet<String>& p_visited) const;
+        void _settle(Environment* p_env, const v8::Local<v8::Context>& p_context, Request& p_request);
+
+        HashMap<String, Entry> entries_;
+        std::vector<Request> requests_;
+        // the function creating a Promise with its resolving functions (`[promise, resolve, reject]`)
+        v8::Global<v8::Function> deferred_;
+        Stats stats_;
+    };
+}
+#endif
@@ -1,10 +1,73 @@
 #include "jsb_module_resolver.h"
 #include "jsb_environment.h"
+#include "jsb_type_convert.h"
+#include "jsb_bootstrap_cache.h"
+#include "jsb_json_module_cache.h"
 
 #include "../internal/jsb_path_util.h"
 
 namespace jsb
 {
+    namespace
+    {
+        // the exports of a lazy JSON module, it's a proxy of an empty object (or array) until any property is accessed.
+        // `load` is called only once (with the source bytes read when required), then the parsed value is kept by the closure and the source is released.
+        // the invariants of Proxy are checked against the target, so the non-configurable properties and the extensibility
+        // of the value are mirrored to the target (e.g. `Object.freeze(exports)`).
+        constexpr char kLazyJsonSource[] = R"--((function (is_array, load, source) {
+    let value;
+    const get = function () { if (load) { value = load(source); load = source = undefined; } return value; };
+    const sync = function (target, key) {
+        const desc = Reflect.getOwnPropertyDescriptor(value, key);
+        if (desc && (!desc.configurable || !Reflect.isExtensible(target))) Reflect.defineProperty(target, key, desc);
+    };
+    return new Proxy(is_array ? [] : {}, {
+        get: function (_, key) { return Reflect.get(get(), key); },
+        set: function (_, key, v) { return Reflect.set(get(), key, v); },
+        has: function (_, key) { return Reflect.has(get(), key); },
+        deleteProperty: function (target, key) {
+            if (!Reflect.deleteProperty(get(), key)) return false;
+            Reflect.deleteProperty(target, key);
+            return true;
+        },
+        defineProperty: function (target, key, desc) {
+            if (!Reflect.defineProperty(get(), key, desc)) return false;
+            sync(target, key);
+            return true;
+        },
+        ownKeys: function () { return Reflect.ownKeys(get()); },
+        getOwnPropertyDescriptor: function (_, key) { return Reflect.getOwnPropertyDescriptor(get(), key); },
+        getPrototypeOf: function () { return Reflect.getPrototypeOf(get()); },
+        isExtensible: function () { return Reflect.isExtensible(get()); },
+        preventExtensions: function (target) {
+            if (!Reflect.preventExtensions(get())) return false;
+            for (const key of Reflect.ownKeys(value)) Reflect.defineProperty(target, key, Reflect.getOwnPropertyDescriptor(value, key));
+            return Reflect.preventExtensions(target);
+        },
+    });
+}))--";
+
+        // [js] function load(source: PackedByteArray): any; (the asset path as data)
+        void _materialize_json(const v8::FunctionCallbackInfo<v8::Value>& info)
+        {
+            v8::Isolate* isolate = info.GetIsolate();
+            const v8::Local<v8::Context> context = isolate->GetCurrentContext();
+            const String asset_path = impl::Helper::to_string(isolate, info.Data());
+            jsb_check(info.Length() == 1 && info[0]->IsObject() && TypeConvert::is_variant(info[0].As<v8::Object>()));
+
+            // the exports are the content when it's required (zero-terminated), even if the file is changed later
+            const Variant* source = (const Variant*) info[0].As<v8::Object>()->GetAlignedPointerFromInternalField(IF_Pointer);
+            jsb_check(source && source->get_type() == Variant::PACKED_BYTE_ARRAY);
+            const PackedByteArray bytes = *source;
+            JSB_LOG(Verbose, "materialize json module %s", asset_path);
+            v8::Local<v8::Value> rval;
+            if (JsonModuleCache::parse(isolate, context, asset_path, bytes.ptr(), bytes.size() - 1).ToLocal(&rval))
+            {
+                info.GetReturnValue().Set(rval);
+            }
+        }
+    }
+
     bool IModuleResolver::load_as_json(Environment* p_env, JavaScriptModule& p_module, const String& p_asset_path, const Vector<uint8_t>& p_bytes, size_t p_len)
     {
         v8::Isolate* isolate = p_env->get_isolate();
@@ -17,7 +80,7 @@ namespace jsb
         module_obj->Set(context, jsb_name(p_env, path), impl::Helper::new_string(isolate, dirname)).Check();
 
         v8::Local<v8::Value> updated_exports;
-        if (const v8::MaybeLocal<v8::Value> rval = impl::Helper::parse_json(isolate, context, p_bytes.ptr(), p_len); rval.ToLocal(&updated_exports))
+        if (const v8::MaybeLocal<v8::Value> rval = JsonModuleCache::parse(isolate, context, p_asset_path, p_bytes.ptr(), p_len); rval.ToLocal(&updated_exports))
         {
             p_module.exports.Reset(isolate, updated_exports);
             return true;
@@ -234,6 +297,42 @@ namespace jsb
         return false;
     }
 
+    bool DefaultModuleResolver::load_as_lazy_json(Environment* p_env, JavaScriptModule& p_module, const String& p_asset_path, bool p_is_array, const internal::FileContent& p_content)
+    {
+        v8::Isolate* isolate = p_env->get_isolate();
+        const v8::Local<v8::Context> context = isolate->GetCurrentContext();
+        const v8::Local<v8::Object> module_obj = p_module.module.Get(isolate);
+        const String& filename = p_asset_path;
+        const String dirname = internal::PathUtil::dirname(filename);
+
+        module_obj->Set(context, jsb_name(p_env, filename), impl::Helper::new_string(isolate, filename)).Check();
+        module_obj->Set(context, jsb_name(p_env, path), impl::Helper::new_string(isolate, dirname)).Check();
+
+        v8::Local<v8::Value> func;
+        if (!BootstrapCache::compile_function(context, kLazyJsonSource, (int) ::std::size(kLazyJsonSource) - 1, "jsb:lazy_json").ToLocal(&func) || !func->IsFunction())
+        {
+            return false;
+        }
+        // the bytes are shared with the file manager (copy-on-write), not copied
+        v8::Local<v8::Value> source;
+        if (!TypeConvert::gd_var_to_js(isolate, context, Variant(p_content.bytes), Variant::PACKED_BYTE_ARRAY, source))
+        {
+            return false;
+        }
+        v8::Local<v8::Value> argv[] = {
+            v8::Boolean::New(isolate, p_is_array),
+            JSB_NEW_FUNCTION(context, _materialize_json, impl::Helper::new_string(isolate, p_asset_path)),
+            source,
+        };
+        v8::Local<v8::Value> updated_exports;
+        if (!func.As<v8::Function>()->Call(context, v8::Undefined(isolate), (int) ::std::size(argv), argv).ToLocal(&updated_exports))
+        {
+            return false;
+        }
+        p_module.exports.Reset(isolate, updated_exports);
+        return true;
+    }
+
     DefaultModuleResolver& DefaultModuleResolver::add_search_path(const String& p_path)
     {
         String normalized;
@@ -247,28 +346,37 @@ namespace jsb
 
     bool DefaultModuleResolver::load(Environment* p_env, const String& p_asset_path, JavaScriptModule& p_module)
     {
-        // load source buffer
-        const internal::FileAccessSourceReader reader(p_asset_path);
-        if (reader.is_null() || reader.get_length() == 0)
+        // load source buffer (a memory lookup if it's prefetched)
+        internal::FileContent content;
+        if (!internal::FileManager::read(p_asset_path, content) || content.is_empty())
         {
             jsb_throw(p_env->get_isolate(), "failed to read module source");
             return false;
         }
+        const internal::FileContentSourceReader reader(content);
 
 #if JSB_SUPPORT_RELOAD && defined(TOOLS_ENABLED)
         p_module.time_modified = reader.get_time_modified();
+        p_module.file_size = reader.get_length();
         p_module.hash = reader.get_hash();
 #endif
 
-        // parse as JSON
+        // parse as JSON (the content is already zero-terminated)
         if (p_asset_path.ends_with("." JSB_JSON_EXT))
         {
-            Vector<uint8_t> source;
-            const uint64_t len = reader.get_length();
-            source.resize((int) len + 1);
-            source.write[(int) len] = 0; // ensure it's zero-terminated
-            reader.get_buffer(source.ptrw(), len);
-            return load_as_json(p_env, p_module, p_asset_path, source, len);
+#if JSB_JSON_LAZY_THRESHOLD
+            if (content.get_length() >= JSB_JSON_LAZY_THRESHOLD)
+            {
+                // only objects and arrays, the type of exports must be known before parsing
+                const uint8_t* ptr = content.bytes.ptr();
+                while (*ptr == ' ' || *ptr == '\t' || *ptr == '\r' || *ptr == '\n') ++ptr;
+                if (*ptr == '{' || *ptr == '[')
+                {
+                    return load_as_lazy_json(p_env, p_module, p_asset_path, *ptr == '[', content);
+                }
+            }
+#endif
+            return load_as_json(p_env, p_module, p_asset_path, content.bytes, content.get_length());
         }
 
 #if JSB_DEBUG
@@ -38,6 +38,10 @@ namespace jsb
     protected:
         bool check_file_path(const String& p_module_id, ModuleSourceInfo& o_source_info);
 
+        // the exports is a proxy which parses the source on the first access of it (see `JSB_JSON_LAZY_THRESHOLD`),
+        // it fails if the source is not the same as `p_content` then.
+        static bool load_as_lazy_json(Environment* p_env, JavaScriptModule& p_module, const String& p_asset_path, bool p_is_array, const internal::FileContent& p_content);
+
         // read the source buffer (transformed into commonjs)
         static size_t read_all_bytes_with_shebang(const internal::ISourceReader& p_reader, Vector<uint8_t>& o_bytes);
 
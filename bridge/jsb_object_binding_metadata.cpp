@@ -0,0 +1,154 @@
+#include "jsb_object_binding_metadata.h"
+
+namespace jsb
+{
+    namespace
+    {
+        struct ObjectBindingMetadataState
+        {
+            BinaryMutex lock;
+            // keyed by class name, the ClassInfo of an extension class may be freed (and the address reused) by reloading
+            HashMap<StringName, std::shared_ptr<const ObjectBindingMetadata>> classes;
+            uint64_t hits = 0;
+            uint64_t misses = 0;
+        };
+
+        ObjectBindingMetadataState& get_state()
+        {
+            static ObjectBindingMetadataState state;
+            return state;
+        }
+    }
+
+    std::shared_ptr<const ObjectBindingMetadata> ObjectBindingMetadata::get(const ClassDB::ClassInfo* p_class_info)
+    {
+        jsb_check(p_class_info);
+        ObjectBindingMetadataState& state = get_state();
+        MutexLock lock(state.lock);
+        if (const std::shared_ptr<const ObjectBindingMetadata>* it = state.classes.getptr(p_class_info->name);
+            it && (*it)->class_info == p_class_info)
+        {
+            ++state.hits;
+            return *it;
+        }
+
+        // built under the lock, ClassDB is not modified while reading
+        ++state.misses;
+        std::shared_ptr<const ObjectBindingMetadata> metadata = build(p_class_info);
+        state.classes.insert(p_class_info->name, metadata);
+        return metadata;
+    }
+
+    ObjectBindingMetadata::Stats ObjectBindingMetadata::get_stats()
+    {
+        ObjectBindingMetadataState& state = get_state();
+        MutexLock lock(state.lock);
+        Stats stats;
+        stats.classes = state.classes.size();
+        stats.hits = state.hits;
+        stats.misses = state.misses;
+        return stats;
+    }
+
+    void ObjectBindingMetadata::clear()
+    {
+        ObjectBindingMetadataState& state = get_state();
+        MutexLock lock(state.lock);
+        state.classes.clear();
+    }
+
+    void ObjectBindingMetadata::clear_extension_classes()
+    {
+        ObjectBindingMetadataState& state = get_state();
+        MutexLock lock(state.lock);
+        Vector<StringName> extension_classes;
+        for (const KeyValue<StringName, std::shared_ptr<const ObjectBindingMetadata>>& pair : state.classes)
+        {
+            if (pair.value->api == ClassDB::API_EXTENSION || pair.value->api == ClassDB::API_EDITOR_EXTENSION)
+            {
+                extension_classes.push_back(pair.key);
+            }
+        }
+        for (const StringName& class_name : extension_classes)
+        {
+            state.classes.erase(class_name);
+        }
+        JSB_LOG(Verbose, "dropped binding metadata of %d extension classes", extension_classes.size());
+    }
+
+    std::shared_ptr<const ObjectBindingMetadata> ObjectBindingMetadata::build(const ClassDB::ClassInfo* p_class_info)
+    {
+        const std::shared_ptr<ObjectBindingMetadata> metadata = std::make_shared<ObjectBindingMetadata>();
+        metadata->class_info = p_class_info;
+        metadata->name = p_class_info->name;
+        metadata->api = p_class_info->api;
+        metadata->is_singleton = Engine::get_singleton()->has_singleton(p_class_info->name);
+
+#if JSB_EXCLUDE_GETSET_METHODS
+        HashSet<StringName> omitted_methods;
+#endif
+        // properties (getset)
+        for (const KeyValue<StringName, ::ClassDB::PropertySetGet>& pair : p_class_info->property_setget)
+        {
+            if (internal::StringNames::get_singleton().is_ignored(pair.key)) continue;
+
+            const ::ClassDB::PropertySetGet& getset_info = pair.value;
+            metadata->properties.push_back({ pair.key, getset_info._getptr, getset_info._setptr, getset_info.index >= 0 ? getset_info.index : -1 });
+
+            // we do not exclude get/set methods of indexed properties, because the method may not be covered by all properties
+#if JSB_EXCLUDE_GETSET_METHODS
+            if (getset_info.index < 0)
+            {
+                if (internal::VariantUtil::is_valid_name(getset_info.getter)) omitted_methods.insert(getset_info.getter);
+                if (internal::VariantUtil::is_valid_name(getset_info.setter)) omitted_methods.insert(getset_info.setter);
+            }
+#endif
+        }
+
+        // methods
+        for (const KeyValue<StringName, MethodBind*>& pair : p_class_info->method_map)
+        {
+#if JSB_EXCLUDE_GETSET_METHODS
+            if (omitted_methods.has(pair.key)) continue;
+#endif
+            (pair.value->is_static() ? metadata->static_methods : metadata->methods).push_back({ pair.key, pair.value });
+        }
+
+        // signals
+        for (const KeyValue<StringName, MethodInfo>& pair : p_class_info->signal_map)
+        {
+            metadata->signals.push_back(pair.key);
+        }
+
+        // enums (nested in class)
+        HashSet<StringName> enum_consts;
+        for (const KeyValue<StringName, ClassDB::ClassInfo::EnumInfo>& pair : p_class_info->enum_map)
+        {
+            Enumeration enumeration;
+            enumeration.name = pair.key;
+            for (const StringName& enum_name : pair.value.constants)
+            {
+                const String enum_name_str = (String) enum_name;
+                jsb_not_implemented(enum_name_str.contains("."), "hierarchically nested definition is currently not supported");
+                const auto& const_it = p_class_info->constant_map.find(enum_name);
+                jsb_check(const_it);
+                enumeration.values.push_back({ enum_name, enum_name_str, const_it->value });
+                enum_consts.insert(enum_name);
+            }
+            metadata->enums.push_back(std::move(enumeration));
+        }
+
+        // constants
+        for (const KeyValue<StringName, int64_t>& pair : p_class_info->constant_map)
+        {
+            if (enum_consts.has(pair.key)) continue;
+            const String const_name_str = (String) pair.key;
+            jsb_not_implemented(const_name_str.contains("."), "hierarchically nested definition is currently not supported");
+            metadata->constants.push_back({ pair.key, const_name_str, pair.value });
+        }
+
+        JSB_LOG(VeryVerbose, "build binding metadata %s (%d properties, %d methods, %d signals)",
+            metadata->name, metadata->properties.size(), metadata->methods.size() + metadata->static_methods.size(), metadata->signals.size());
+        return metadata;
+    }
+}
@@ -0,0 +1,83 @@
+#ifndef GODOTJS_OBJECT_BINDING_METADATA_H
+#define GODOTJS_OBJECT_BINDING_METADATA_H
+#include "jsb_bridge_pch.h"
+
+namespace jsb
+{
+    // Precomputed (immutable) binding metadata of a godot class.
+    // It's collected from ClassDB only once in the process, and shared by all environments (master, workers and shadow environments).
+    struct ObjectBindingMetadata
+    {
+        struct Property
+        {
+            StringName name;
+            MethodBind* getter = nullptr;
+            MethodBind* setter = nullptr;
+
+            // the index argument for indexed properties (-1 if not indexed)
+            int index = -1;
+        };
+
+        struct Method
+        {
+            StringName name;
+            MethodBind* bind = nullptr;
+        };
+
+        struct Constant
+        {
+            StringName name;
+            // cached string for the template builder
+            String name_str;
+            int64_t value = 0;
+        };
+
+        struct Enumeration
+        {
+            StringName name;
+            Vector<Constant> values;
+        };
+
+        const ClassDB::ClassInfo* class_info = nullptr;
+        StringName name;
+
+        // extension classes (and their MethodBinds) are freed when the extension is unloaded or reloaded
+        ClassDB::APIType api = ClassDB::API_NONE;
+
+        // all singleton object will overwrite the class itself in 'godot' module
+        bool is_singleton = false;
+
+        Vector<Property> properties;
+        // instance methods and static methods
+        // (getters/setters are already excluded if JSB_EXCLUDE_GETSET_METHODS)
+        Vector<Method> methods;
+        Vector<Method> static_methods;
+        Vector<StringName> signals;
+        Vector<Enumeration> enums;
+        // constants not in any enum
+        Vector<Constant> constants;
+
+        struct Stats
+        {
+            int classes = 0;
+            uint64_t hits = 0;
+            uint64_t misses = 0;
+        };
+
+        // [thread safe] get the metadata of a class (built on the first access, and rebuilt if the class is registered again)
+        static std::shared_ptr<const ObjectBindingMetadata> get(const ClassDB::ClassInfo* p_class_info);
+
+        static Stats get_stats();
+
+        // drop all metadata (e.g. ClassDB changed), it's only used by the following `get` calls.
+        static void clear();
+
+        // drop the metadata of extension classes (extensions loaded, unloading or reloaded)
+        static void clear_extension_classes();
+
+    private:
+        static std::shared_ptr<const ObjectBindingMetadata> build(const ClassDB::ClassInfo* p_class_info);
+    };
+}
+
+#endif
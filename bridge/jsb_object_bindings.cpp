@@ -1,4 +1,5 @@
 #include "jsb_object_bindings.h"
+#include "jsb_object_binding_metadata.h"
 #include "jsb_transpiler.h"
 #include "jsb_type_convert.h"
 
@@ -16,112 +17,77 @@ namespace jsb
 
         // construct type template
         {
-
+            // the metadata is collected from ClassDB only once, and shared by all environments
+            const std::shared_ptr<const ObjectBindingMetadata> metadata = ObjectBindingMetadata::get(p_class_info);
             impl::ClassBuilder class_builder = ClassTemplate<Object>::create(p_env, class_id);
 
             //NOTE all singleton object will overwrite the class itself in 'godot' module, so we need make all things defined on PrototypeTemplate.
-            const bool is_singleton_class = Engine::get_singleton()->has_singleton(p_class_info->name);
-            auto static_builder = is_singleton_class ? class_builder.Instance() : class_builder.Static();
+            auto static_builder = metadata->is_singleton ? class_builder.Instance() : class_builder.Static();
 
-#if JSB_EXCLUDE_GETSET_METHODS
-            HashSet<StringName> omitted_methods;
-#endif
             // class: properties (getset)
-            for (const KeyValue<StringName, ::ClassDB::PropertySetGet>& pair : p_class_info->property_setget)
+            for (const ObjectBindingMetadata::Property& property : metadata->properties)
             {
-                if (internal::StringNames::get_singleton().is_ignored(pair.key)) continue;
-
-                const StringName& property_name = pair.key;
-                const ::ClassDB::PropertySetGet& getset_info = pair.value;
-
-                if (pair.value.index >= 0)
+                if (property.index >= 0)
                 {
                     const int remap_index = (int) p_env->get_variant_info_collection().properties2.size();
                     internal::FPropertyInfo2 property_info2;
-                    property_info2.getter_func = getset_info._getptr;
-                    property_info2.setter_func = getset_info._setptr;
-                    property_info2.index = pair.value.index;
+                    property_info2.getter_func = property.getter;
+                    property_info2.setter_func = property.setter;
+                    property_info2.index = property.index;
                     p_env->get_variant_info_collection().properties2.append(property_info2);
 
-                    class_builder.Instance().Property(property_name,
-                        getset_info._getptr ? _godot_object_get2 : nullptr,
-                        getset_info._setptr ? _godot_object_set2 : nullptr, remap_index);
-                    // we do not exclude get/set methods in this case, because the method may not be covered by all properties
+                    class_builder.Instance().Property(property.name,
+                        property.getter ? _godot_object_get2 : nullptr,
+                        property.setter ? _godot_object_set2 : nullptr, remap_index);
                 }
                 else
                 {
                     // not using `property_collection_` in this case due to lower memory cost
-                    class_builder.Instance().Property(property_name,
-                        getset_info._getptr ? _godot_object_method : nullptr, (void*) getset_info._getptr,
-                        getset_info._setptr ? _godot_object_method : nullptr, (void*) getset_info._setptr);
-
-#if JSB_EXCLUDE_GETSET_METHODS
-                    if (internal::VariantUtil::is_valid_name(getset_info.getter)) omitted_methods.insert(getset_info.getter);
-                    if (internal::VariantUtil::is_valid_name(getset_info.setter)) omitted_methods.insert(getset_info.setter);
-#endif
+                    class_builder.Instance().Property(property.name,
+                        property.getter ? _godot_object_method : nullptr, (void*) property.getter,
+                        property.setter ? _godot_object_method : nullptr, (void*) property.setter);
                 }
             }
 
             // class: methods
-            for (const KeyValue<StringName, MethodBind*>& pair : p_class_info->method_map)
+            for (const ObjectBindingMetadata::Method& method : metadata->methods)
             {
-#if JSB_EXCLUDE_GETSET_METHODS
-                if (omitted_methods.has(pair.key)) continue;
-#endif
-                const StringName& method_name = pair.key;
-                const MethodBind* method_bind = pair.value;
+                class_builder.Instance().Method(method.name, _godot_object_method, (void*) method.bind);
+            }
+            for (const ObjectBindingMetadata::Method& method : metadata->static_methods)
+            {
+                static_builder.Method(method.name, _godot_object_method, (void*) method.bind);
+            }
 
-                if (method_bind->is_static())
-                {
-                    static_builder.Method(method_name, _godot_object_method, (void*) method_bind);
-                }
-                else
+            if (p_class_info->name == jsb_string_name(Object))
+            {
+                // class: special methods
+                class_builder.Instance().Method(jsb_literal(free), _godot_object_free);
+            }
+
+            // class: signals
+            for (const StringName& signal_name : metadata->signals)
+            {
+                const StringNameID string_id = p_env->get_string_name_cache().get_string_id(signal_name);
+                class_builder.Instance().Property(signal_name, _godot_object_signal, *string_id);
+            }
+
+            // class: enum (nested in class)
+            for (const ObjectBindingMetadata::Enumeration& enum_info : metadata->enums)
+            {
+                v8::HandleScope handle_scope_for_enum(isolate);
+                impl::ClassBuilder::EnumDeclaration enumeration = static_builder.Enum(enum_info.name);
+                for (const ObjectBindingMetadata::Constant& value : enum_info.values)
                 {
-                    class_builder.Instance().Method(method_name, _godot_object_method, (void*) method_bind);
+                    enumeration.Value(value.name_str, value.value);
                 }
             }
 
-             if (p_class_info->name == jsb_string_name(Object))
-             {
-                 // class: special methods
-                 class_builder.Instance().Method(jsb_literal(free), _godot_object_free);
-             }
-
-             // class: signals
-             for (const KeyValue<StringName, MethodInfo>& pair : p_class_info->signal_map)
-             {
-                 const StringName& name_str = pair.key;
-                 const StringNameID string_id = p_env->get_string_name_cache().get_string_id(name_str);
-                 class_builder.Instance().Property(pair.key, _godot_object_signal, *string_id);
-             }
-
-             HashSet<StringName> enum_consts;
-
-             // class: enum (nested in class)
-             for (const KeyValue<StringName, ClassDB::ClassInfo::EnumInfo>& pair : p_class_info->enum_map)
-             {
-                 v8::HandleScope handle_scope_for_enum(isolate);
-                 impl::ClassBuilder::EnumDeclaration enumeration = static_builder.Enum(pair.key);
-                 for (const StringName& enum_name : pair.value.constants)
-                 {
-                     const String& enum_name_str = (String) enum_name;
-                     jsb_not_implemented(enum_name_str.contains("."), "hierarchically nested definition is currently not supported");
-                     const auto& const_it = p_class_info->constant_map.find(enum_name);
-                     jsb_check(const_it);
-                     enumeration.Value(enum_name_str, const_it->value);
-                     enum_consts.insert(enum_name);
-                 }
-             }
-
-             // class: constants
-             for (const KeyValue<StringName, int64_t>& pair : p_class_info->constant_map)
-             {
-                 if (enum_consts.has(pair.key)) continue;
-                 const String& const_name_str = (String) pair.key;
-                 jsb_not_implemented(const_name_str.contains("."), "hierarchically nested definition is currently not supported");
-
-                 static_builder.Value(pair.key, pair.value);
-             }
+            // class: constants
+            for (const ObjectBindingMetadata::Constant& constant : metadata->constants)
+            {
+                static_builder.Value(constant.name_str, constant.value);
+            }
 
             // set `class_id` on the exposed godot native class for the convenience when finding it from any subclasses in javascript.
             class_builder.Static().Value(jsb_symbol(p_env, ClassId), *class_id);
@@ -263,7 +229,9 @@ namespace jsb
         const int argc = info.Length();
 
         jsb_check(method_bind);
-        Environment::wrap(isolate)->check_internal_state();
+        Environment* env = Environment::wrap(isolate);
+        env->check_internal_state();
+        JSB_BRIDGE_COUNTER_INC(env, ObjectMethodCall);
         Object* gd_object = nullptr;
         if (!method_bind->is_static())
         {
@@ -303,7 +271,16 @@ namespace jsb
 
         // call godot method
         Callable::CallError error;
+#if JSB_WITH_CALL_PROFILER
+        const uint64_t profiling_begin = internal::CallProfiler::begin();
+#endif
         Variant crval = method_bind->call(gd_object, argv, argc, error);
+#if JSB_WITH_CALL_PROFILER
+        if (jsb_unlikely(profiling_begin))
+        {
+            internal::CallProfiler::end(internal::CallProfiler::NativeCall, {}, method_bind->get_instance_class(), method_bind->get_name(), profiling_begin);
+        }
+#endif
 
         // don't forget to destruct all stack allocated variants
         for (int index = 0; index < argc; ++index)
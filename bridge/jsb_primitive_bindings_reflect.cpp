@@ -450,6 +450,7 @@ namespace jsb
         static void call_builtin_function(Variant* self, const internal::FBuiltinMethodInfo& method_info,
             const v8::FunctionCallbackInfo<v8::Value>& info, v8::Isolate* isolate, const v8::Local<v8::Context>& context)
         {
+            JSB_BRIDGE_COUNTER_INC(Environment::wrap(isolate), BuiltinFunctionCall);
             const int argc = info.Length();
             if (!method_info.check_argc(argc))
             {
@@ -2,10 +2,32 @@
 #define GODOTJS_STATISTICS_H
 
 #include "jsb_bridge_pch.h"
+#include "jsb_bridge_counters.h"
+#include "jsb_string_value_cache.h"
+#include "jsb_function_registry.h"
+#include "jsb_module_fetcher.h"
 #include "../impl/shared/jsb_custom_field.h"
 
 namespace jsb
 {
+    // the pool of shadow environments (used on the resource loader threads, see `GodotJSScriptLanguage::create_shadow_environment`)
+    struct ShadowEnvironmentStats
+    {
+        // idle ones in pool, and in use
+        uint32_t idle;
+        uint32_t in_use;
+
+        // acquired from the pool, and created on demand (not available in pool)
+        uint64_t hits;
+        uint64_t misses;
+
+        // created in background ahead of demand
+        uint64_t prewarmed;
+
+        // disposed on released since the pool is full (or replaced by a fresh one since it has run user code)
+        uint64_t disposed;
+    };
+
     struct Statistics
     {
         // num of traced objects
@@ -18,11 +40,41 @@ namespace jsb
         int script_classes;
 
         int cached_string_names;
+
+        // short String values cached for conversions (see `StringValueCache`)
+        StringValueCache::Stats string_value_cache;
+
+        // JS functions referenced by Callables (see `FunctionRegistry`)
+        FunctionRegistry::Stats callable_functions;
+
+        // modules loaded asynchronously (see `ModuleFetcher`)
+        ModuleFetcher::Stats module_fetcher;
+
+        // script sources cached in memory, it's not per environment (see `internal::FileManager`)
+        internal::FileManager::Stats script_sources;
+
         uint32_t persistent_objects;
 
         // allocated num of Variants in pool (only valid in debug mode)
         uint32_t allocated_variants;
 
+        // num of console messages dropped by the async logger (buffer full or rate limited)
+        uint32_t dropped_logs;
+
+        // bytes of recycled ArrayBuffer blocks kept in the pool, and bytes of alive ArrayBuffers (see `ArrayBufferAllocator`)
+        uint64_t array_buffer_pooled_bytes;
+        uint64_t array_buffer_outstanding_bytes;
+
+        // bytes used by the JS heap (see `impl::Helper::get_memory_used`), and the current `MemoryPressureLevel`
+        uint64_t memory_used;
+        uint8_t memory_pressure_level;
+
+        // it's not per environment, only filled by the statistics collectors of GodotJSScriptLanguage
+        ShadowEnvironmentStats shadow_environments;
+
+        // bridge traffic in the last frame (always zero if `JSB_WITH_BRIDGE_COUNTERS` is off)
+        BridgeCounters::Snapshot bridge_last_frame;
+
         // impl-specific fields
         Vector<impl::CustomField> custom_fields;
 
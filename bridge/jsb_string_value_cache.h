@@ -0,0 +1,119 @@
+#ifndef GODOTJS_STRING_VALUE_CACHE_H
+#define GODOTJS_STRING_VALUE_CACHE_H
+#include "jsb_bridge_pch.h"
+#include "jsb_ref.h"
+
+namespace jsb
+{
+    // A bounded cache of the short String values recently converted in an Environment (direct-mapped by the String hash).
+    // Repeated values (animation names, input actions, states) map to the same JS string in both directions,
+    // so they are neither transcoded nor allocated again.
+    // The JS strings are strongly referenced by the slots until evicted or cleared (on GC requests),
+    // so the identity index never refers to a collected string.
+    struct StringValueCache
+    {
+        struct Stats
+        {
+            int entries = 0;
+            uint64_t hits = 0;
+            uint64_t misses = 0;
+        };
+
+    private:
+#if JSB_STRING_VALUE_CACHE_SIZE
+        static_assert((JSB_STRING_VALUE_CACHE_SIZE & (JSB_STRING_VALUE_CACHE_SIZE - 1)) == 0, "JSB_STRING_VALUE_CACHE_SIZE must be a power of 2");
+
+        struct Slot
+        {
+            String value;
+            v8::Global<v8::String> js_value;
+        };
+
+        Slot slots_[JSB_STRING_VALUE_CACHE_SIZE];
+
+        // JSValue => slot index
+        internal::TypeGen<TWeakRef<v8::String>, uint32_t>::UnorderedMap value_index_;
+#endif
+        Stats stats_;
+
+    public:
+        jsb_force_inline const Stats& get_stats() const { return stats_; }
+
+        void clear()
+        {
+#if JSB_STRING_VALUE_CACHE_SIZE
+            value_index_.clear();
+            for (Slot& slot : slots_)
+            {
+                slot.value = String();
+                slot.js_value.Reset();
+            }
+#endif
+            stats_.entries = 0;
+        }
+
+        // String => JSValue
+        v8::Local<v8::String> get_string_value(v8::Isolate* isolate, const String& p_value)
+        {
+#if JSB_STRING_VALUE_CACHE_SIZE
+            const int len = p_value.length();
+            if (len != 0 && len <= JSB_STRING_VALUE_CACHE_MAX_LENGTH)
+            {
+                const uint32_t index = p_value.hash() & (JSB_STRING_VALUE_CACHE_SIZE - 1);
+                if (const Slot& slot = slots_[index]; !slot.js_value.IsEmpty() && slot.value == p_value)
+                {
+                    ++stats_.hits;
+                    return slot.js_value.Get(isolate);
+                }
+                ++stats_.misses;
+                const v8::Local<v8::String> js_value = impl::Helper::new_string(isolate, p_value);
+                _set(isolate, index, p_value, js_value);
+                return js_value;
+            }
+#endif
+            return impl::Helper::new_string(isolate, p_value);
+        }
+
+        // JSValue => String
+        String get_string(v8::Isolate* isolate, const v8::Local<v8::String>& p_value)
+        {
+#if JSB_STRING_VALUE_CACHE_SIZE
+            const int len = p_value->Length();
+            if (len != 0 && len <= JSB_STRING_VALUE_CACHE_MAX_LENGTH)
+            {
+                if (const auto& it = value_index_.find(TWeakRef(isolate, p_value)); it != value_index_.end())
+                {
+                    ++stats_.hits;
+                    return slots_[it->second].value;
+                }
+                ++stats_.misses;
+                const String value = impl::Helper::to_string(isolate, p_value);
+                _set(isolate, value.hash() & (JSB_STRING_VALUE_CACHE_SIZE - 1), value, p_value);
+                return value;
+            }
+#endif
+            return impl::Helper::to_string(isolate, p_value);
+        }
+
+    private:
+#if JSB_STRING_VALUE_CACHE_SIZE
+        // the latest JS string wins if the same content is converted from different JS strings
+        void _set(v8::Isolate* isolate, uint32_t p_index, const String& p_value, const v8::Local<v8::String>& p_js_value)
+        {
+            Slot& slot = slots_[p_index];
+            if (slot.js_value.IsEmpty())
+            {
+                ++stats_.entries;
+            }
+            else
+            {
+                value_index_.erase(TWeakRef(isolate, slot.js_value.Get(isolate)));
+            }
+            slot.value = p_value;
+            slot.js_value.Reset(isolate, p_js_value);
+            value_index_.insert(std::pair(TWeakRef(isolate, p_js_value), p_index));
+        }
+#endif
+    };
+}
+#endif
@@ -47,43 +47,166 @@ namespace jsb
 #endif
     }
 
-    static bool try_convert_array_any(v8::Isolate* isolate, const v8::Local<v8::Context>& context, v8::Local<v8::Value> p_val, Variant& r_packed)
+    // Translate nested javascript arrays/plain objects in a single pass.
+    // The containers being translated are kept in `stack` to detect cyclic references (a shared but acyclic value is translated for each reference).
+    struct ContainerConversion
     {
-#if JSB_IMPLICIT_PACKED_ARRAY_CONVERSION
-        if (!p_val->IsArray())
+        v8::Isolate* isolate;
+        const v8::Local<v8::Context>& context;
+        Environment* environment;
+        v8::Local<v8::Value> object_prototype;
+        Vector<v8::Local<v8::Object>> stack;
+
+        ContainerConversion(v8::Isolate* p_isolate, const v8::Local<v8::Context>& p_context)
+            : isolate(p_isolate), context(p_context), environment(Environment::wrap(p_isolate)) {}
+
+        bool is_plain_object(const v8::Local<v8::Object>& p_obj)
         {
-            return false;
+            if (p_obj->InternalFieldCount() != 0 || p_obj->IsFunction() || p_obj->IsPromise() || p_obj->IsMap() || p_obj->IsArrayBuffer())
+            {
+                return false;
+            }
+            if (object_prototype.IsEmpty())
+            {
+                object_prototype = v8::Object::New(isolate)->GetPrototype();
+            }
+            const v8::Local<v8::Value> prototype = p_obj->GetPrototype();
+            return prototype == object_prototype || prototype->IsNullOrUndefined();
         }
 
-        const v8::Local<v8::Array> array = p_val.As<v8::Array>();
-        const uint32_t len = array->Length();
-        Array packed;
-        packed.resize((int)len);
-        for (uint32_t index = 0; index < len; ++index)
+        bool enter(const v8::Local<v8::Object>& p_obj)
         {
-            v8::Local<v8::Value> element;
-            Variant element_var;
-            if (array->Get(context, index).ToLocal(&element) && TypeConvert::js_to_gd_var(isolate, context, element, element_var))
+            if (stack.size() >= JSB_CONTAINER_CONVERSION_MAX_DEPTH)
             {
-                packed.set((int) index, element_var);
+                JSB_LOG(Error, "failed to convert a nested array/object deeper than %d", JSB_CONTAINER_CONVERSION_MAX_DEPTH);
+                return false;
             }
-            else
+            for (const v8::Local<v8::Object>& it : stack)
             {
-                // be cautious here, we silently omit conversion failures
-                packed.set((int) index, {});
-                JSB_LOG(Warning, "failed to convert array element %d (loosely), it'll be left as the default value", index);
+                if (it == p_obj)
+                {
+                    JSB_LOG(Error, "failed to convert an array/object with cyclic references");
+                    return false;
+                }
             }
+            stack.push_back(p_obj);
+            return true;
         }
-        r_packed = packed;
-        return true;
+
+        bool convert(const v8::Local<v8::Value>& p_jval, Variant& r_cvar)
+        {
+            if (p_jval->IsArray())
+            {
+                return convert_array(p_jval.As<v8::Array>(), r_cvar);
+            }
+            if (p_jval->IsObject() && is_plain_object(p_jval.As<v8::Object>()))
+            {
+                return convert_object(p_jval.As<v8::Object>(), r_cvar);
+            }
+            if (TypeConvert::js_to_gd_var(isolate, context, p_jval, r_cvar))
+            {
+                return true;
+            }
+            // be cautious here, we silently omit conversion failures of the elements
+            r_cvar = {};
+            JSB_LOG(Warning, "failed to convert an element (loosely), it'll be left as the default value");
+            return true;
+        }
+
+        bool convert_array(const v8::Local<v8::Array>& p_array, Variant& r_cvar)
+        {
+            if (!enter(p_array)) return false;
+            v8::HandleScope handle_scope(isolate);
+            const uint32_t len = p_array->Length();
+            Array packed;
+            packed.resize((int) len);
+            for (uint32_t index = 0; index < len; ++index)
+            {
+                v8::Local<v8::Value> element;
+                if (!p_array->Get(context, index).ToLocal(&element) || !convert(element, packed[(int) index]))
+                {
+                    return false;
+                }
+            }
+            stack.remove_at(stack.size() - 1);
+            r_cvar = packed;
+            return true;
+        }
+
+        bool convert_object(const v8::Local<v8::Object>& p_obj, Variant& r_cvar)
+        {
+            if (!enter(p_obj)) return false;
+            v8::HandleScope handle_scope(isolate);
+            v8::Local<v8::Array> keys;
+            if (!p_obj->GetOwnPropertyNames(context, (v8::PropertyFilter)(v8::ONLY_ENUMERABLE | v8::SKIP_SYMBOLS), v8::KeyConversionMode::kNoNumbers).ToLocal(&keys))
+            {
+                return false;
+            }
+            const uint32_t len = keys->Length();
+            Dictionary dict;
+            for (uint32_t index = 0; index < len; ++index)
+            {
+                v8::Local<v8::Value> key;
+                v8::Local<v8::Value> value;
+                if (!keys->Get(context, index).ToLocal(&key) || !p_obj->Get(context, key).ToLocal(&value))
+                {
+                    return false;
+                }
+                // integer-like keys may be returned as numbers even with `kNoNumbers`
+                v8::Local<v8::String> key_str;
+                if (key->IsString()) key_str = key.As<v8::String>();
+                else if (!key->ToString(context).ToLocal(&key_str)) return false;
+
+                // keys are usually repeated in the structured data, take them from the cache
+                if (!convert(value, dict[environment->get_string_value_cache().get_string(isolate, key_str)]))
+                {
+                    return false;
+                }
+            }
+            stack.remove_at(stack.size() - 1);
+            r_cvar = dict;
+            return true;
+        }
+    };
+
+    static bool try_convert_array_any(v8::Isolate* isolate, const v8::Local<v8::Context>& context, v8::Local<v8::Value> p_val, Variant& r_packed)
+    {
+#if JSB_IMPLICIT_PACKED_ARRAY_CONVERSION
+        if (!p_val->IsArray())
+        {
+            return false;
+        }
+        return ContainerConversion(isolate, context).convert_array(p_val.As<v8::Array>(), r_packed);
+#else
+        return false;
+#endif
+    }
+
+    static bool try_convert_dictionary(v8::Isolate* isolate, const v8::Local<v8::Context>& context, v8::Local<v8::Value> p_val, Variant& r_dict)
+    {
+#if JSB_IMPLICIT_DICTIONARY_CONVERSION
+        if (!p_val->IsObject() || p_val->IsArray())
+        {
+            return false;
+        }
+        ContainerConversion conversion(isolate, context);
+        const v8::Local<v8::Object> obj = p_val.As<v8::Object>();
+        return conversion.is_plain_object(obj) && conversion.convert_object(obj, r_dict);
 #else
         return false;
 #endif
     }
 
+    bool TypeConvert::js_to_gd_container(v8::Isolate* isolate, const v8::Local<v8::Context>& context, const v8::Local<v8::Value>& p_jval, Variant& r_cvar)
+    {
+        return ContainerConversion(isolate, context).convert(p_jval, r_cvar);
+    }
+
     // translate js val into gd variant with an expected type
     bool TypeConvert::js_to_gd_var(v8::Isolate* isolate, const v8::Local<v8::Context>& context, const v8::Local<v8::Value>& p_jval, Variant::Type p_type, Variant& r_cvar)
     {
+        // NIL is counted in the untyped version
+        if (p_type != Variant::NIL) JSB_BRIDGE_COUNTER_JS_TO_GD(Environment::wrap(isolate), p_type);
         switch (p_type)
         {
         case Variant::FLOAT:
@@ -130,13 +253,14 @@ namespace jsb
         case Variant::STRING:
             if (p_jval->IsString())
             {
+                Environment* environment = Environment::wrap(isolate);
                 StringName sn;
-                if (Environment::wrap(isolate)->get_string_name_cache().try_get_string_name(isolate, p_jval, sn))
+                if (environment->get_string_name_cache().try_get_string_name(isolate, p_jval, sn))
                 {
                     r_cvar = (String) sn;
                     return true;
                 }
-                r_cvar = impl::Helper::to_string(isolate, p_jval);
+                r_cvar = environment->get_string_value_cache().get_string(isolate, p_jval.As<v8::String>());
                 return true;
             }
             return false;
@@ -171,6 +295,7 @@ namespace jsb
         case Variant::PACKED_VECTOR3_ARRAY: if (try_convert_array<Vector3>(isolate, context, p_jval, r_cvar)) return true; goto FALLBACK_TO_VARIANT;  // NOLINT(cppcoreguidelines-avoid-goto, hicpp-avoid-goto)
         case Variant::PACKED_COLOR_ARRAY:   if (try_convert_array<Color>(isolate, context, p_jval, r_cvar))   return true; goto FALLBACK_TO_VARIANT;  // NOLINT(cppcoreguidelines-avoid-goto, hicpp-avoid-goto)
         case Variant::ARRAY:                if (try_convert_array_any(isolate, context, p_jval, r_cvar))      return true; goto FALLBACK_TO_VARIANT;  // NOLINT(cppcoreguidelines-avoid-goto, hicpp-avoid-goto)
+        case Variant::DICTIONARY:           if (try_convert_dictionary(isolate, context, p_jval, r_cvar))     return true; goto FALLBACK_TO_VARIANT;  // NOLINT(cppcoreguidelines-avoid-goto, hicpp-avoid-goto)
         // math types
         case Variant::VECTOR2:
         case Variant::VECTOR2I:
@@ -193,7 +318,6 @@ namespace jsb
         case Variant::RID:
         case Variant::CALLABLE:
         case Variant::SIGNAL:
-        case Variant::DICTIONARY:
             {
                 FALLBACK_TO_VARIANT:
                 if (!p_jval->IsObject())
@@ -220,6 +344,7 @@ namespace jsb
 
     bool TypeConvert::gd_var_to_js(v8::Isolate* isolate, const v8::Local<v8::Context>& context, const Variant& p_cvar, Variant::Type p_type, v8::Local<v8::Value>& r_jval)
     {
+        JSB_BRIDGE_COUNTER_GD_TO_JS(Environment::wrap(isolate), p_type);
         switch (p_type)
         {
         case Variant::FLOAT:
@@ -252,7 +377,7 @@ namespace jsb
         case Variant::STRING:
             {
                 const String str = p_cvar;
-                r_jval = impl::Helper::new_string(isolate, str);
+                r_jval = Environment::wrap(isolate)->get_string_value_cache().get_string_value(isolate, str);
                 return true;
             }
         case Variant::STRING_NAME:
@@ -359,6 +484,7 @@ namespace jsb
 
     bool TypeConvert::js_to_gd_var(v8::Isolate* isolate, const v8::Local<v8::Context>& context, const v8::Local<v8::Value>& p_jval, Variant& r_cvar)
     {
+        JSB_BRIDGE_COUNTER_JS_TO_GD(Environment::wrap(isolate), Variant::NIL);
         if (p_jval.IsEmpty() || p_jval->IsNullOrUndefined())
         {
             r_cvar = {};
@@ -387,13 +513,14 @@ namespace jsb
         if (p_jval->IsString())
         {
             // directly return from cached StringName only if it exists
+            Environment* environment = Environment::wrap(isolate);
             StringName sn;
-            if (Environment::wrap(isolate)->get_string_name_cache().try_get_string_name(isolate, p_jval, sn))
+            if (environment->get_string_name_cache().try_get_string_name(isolate, p_jval, sn))
             {
                 r_cvar = sn;
                 return true;
             }
-            r_cvar = impl::Helper::to_string(isolate, p_jval);
+            r_cvar = environment->get_string_value_cache().get_string(isolate, p_jval.As<v8::String>());
             return true;
         }
         // is it proper to convert a ArrayBuffer into Vector<uint8_t>?
@@ -469,6 +596,12 @@ namespace jsb
                 return true;
             }
 
+        case Variant::DICTIONARY:
+#if JSB_IMPLICIT_DICTIONARY_CONVERSION
+            // only plain objects, the same rule as the conversion (instances of classes are not dictionaries)
+            if (p_val->IsObject() && !p_val->IsArray() && ContainerConversion(isolate, context).is_plain_object(p_val.As<v8::Object>())) return true;
+#endif
+            goto FALLBACK_TO_VARIANT;  // NOLINT(cppcoreguidelines-avoid-goto, hicpp-avoid-goto)
         case Variant::ARRAY:
         // typed arrays
         case Variant::PACKED_BYTE_ARRAY:
@@ -505,7 +638,6 @@ namespace jsb
         case Variant::RID:
         case Variant::CALLABLE:
         case Variant::SIGNAL:
-        case Variant::DICTIONARY:
             {
                 FALLBACK_TO_VARIANT:
                 if (!p_val->IsObject())
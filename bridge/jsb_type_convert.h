@@ -31,6 +31,12 @@ namespace jsb
          */
         static bool js_to_gd_var(v8::Isolate* isolate, const v8::Local<v8::Context>& context, const v8::Local<v8::Value>& p_jval, Variant& r_cvar);
 
+        /**
+         * Translate js val into gd variant without any type hint, javascript arrays and plain objects are translated into Array and Dictionary recursively.
+         * Return false on cyclic references, or if nested deeper than JSB_CONTAINER_CONVERSION_MAX_DEPTH.
+         */
+        static bool js_to_gd_container(v8::Isolate* isolate, const v8::Local<v8::Context>& context, const v8::Local<v8::Value>& p_jval, Variant& r_cvar);
+
         /**
          * Check if a javascript value `p_val` could be converted into the expected primitive type `p_type`
          */
@@ -3,6 +3,7 @@
 #include "jsb_environment.h"
 #include "jsb_type_convert.h"
 #include "../internal/jsb_sarray.h"
+#include "../internal/jsb_settings.h"
 #include "../internal/jsb_thread_util.h"
 #include "../internal/jsb_double_buffered.h"
 
@@ -19,6 +20,7 @@ namespace jsb
         WorkerID id_ = {};
         void* token_ = nullptr;
         String path_;
+        MemoryBudget memory_budget_;
 
         SafeFlag interrupt_requested_ = SafeFlag(false);
         Thread thread_;
@@ -30,8 +32,8 @@ namespace jsb
         internal::DoubleBuffered<Buffer> inbox_;
 
     public:
-        WorkerImpl(Environment* p_master, const String& p_path, NativeObjectID p_handle)
-        : token_(p_master), path_(p_path), handle_(p_handle)
+        WorkerImpl(Environment* p_master, const String& p_path, NativeObjectID p_handle, const MemoryBudget& p_memory_budget)
+        : token_(p_master), path_(p_path), memory_budget_(p_memory_budget), handle_(p_handle)
         {
         }
 
@@ -65,6 +67,7 @@ namespace jsb
                 params.initial_script_slots = JSB_WORKER_INITIAL_SCRIPT_SLOTS;
                 params.thread_id = Thread::get_caller_id();
                 params.type = Environment::Type::Worker;
+                params.memory_budget = impl->memory_budget_;
 
                 const std::shared_ptr<Environment> env = std::make_shared<Environment>(params);
                 impl->env_ = env;
@@ -145,11 +148,22 @@ namespace jsb
                         const uint64_t ticks = os->get_ticks_msec();
                         env->update(ticks - last_ticks);
                         last_ticks = ticks;
+                        if (env->is_memory_exceeded()) break;
                         os->delay_usec(10 * 1000);
                     }
                 }
+                else
+                {
+                    // the worker script may fail to load due to out of memory
+                    env->check_memory_budget();
+                }
                 context_obj_handle.Reset();
 
+                if (env->is_memory_exceeded())
+                {
+                    impl->_on_memory_exceeded();
+                }
+
                 impl->interrupt_requested_.set();
                 impl->env_->dispose();
                 impl->env_.reset();
@@ -273,6 +287,40 @@ namespace jsb
             master->post_message(Message(Message::TYPE_READY, handle, Buffer()));
         }
 
+        // (worker) the hard memory limit is hit, report it to the master before terminating
+        void _on_memory_exceeded()
+        {
+            env_->lift_memory_limit();
+
+            NativeObjectID handle;
+            void* token_ptr = nullptr;
+            if (!Worker::try_get_worker(get_id(), handle, token_ptr))
+            {
+                return;
+            }
+            const std::shared_ptr<Environment> master = Environment::_access(token_ptr);
+            if (!master)
+            {
+                return;
+            }
+
+            v8::Isolate* isolate = env_->get_isolate();
+            v8::Isolate::Scope isolate_scope(isolate);
+            v8::HandleScope handle_scope(isolate);
+            const v8::Local<v8::Context> context = env_->get_context();
+            v8::Context::Scope context_scope(context);
+
+            const String error = jsb_format("worker %d terminated: memory limit exceeded (%d/%d bytes)",
+                *get_id(), (uint64_t) env_->get_memory_used(), env_->get_memory_budget().hard_limit);
+            JSB_WORKER_LOG(Error, "%s", error);
+
+            v8::ValueSerializer serializer(isolate);
+            serializer.WriteHeader();
+            serializer.WriteValue(context, impl::Helper::new_string(isolate, error));
+            const std::pair<uint8_t*, size_t> data = serializer.Release();
+            master->post_message(Message(Message::TYPE_ERROR, handle, Buffer::steal(data.first, data.second)));
+        }
+
         // worker.close()
         static void worker_close(const v8::FunctionCallbackInfo<v8::Value>& info)
         {
@@ -395,10 +443,10 @@ namespace jsb
     };
 
     // construct a Worker object (called from master thread)
-    WorkerID Worker::create(Environment* p_master, const String& p_path, NativeObjectID p_handle)
+    WorkerID Worker::create(Environment* p_master, const String& p_path, NativeObjectID p_handle, const MemoryBudget& p_memory_budget)
     {
         lock_.lock();
-        WorkerImplPtr worker = std::make_shared<WorkerImpl>(p_master, p_path, p_handle);
+        WorkerImplPtr worker = std::make_shared<WorkerImpl>(p_master, p_path, p_handle, p_memory_budget);
         const WorkerID id = worker_list_.add(worker);
         worker->init(id);
         jsb_check(worker->get_thread_id() != Thread::UNASSIGNED_ID);
@@ -532,11 +580,41 @@ namespace jsb
             return;
         }
 
+        // options: { softMemoryLimit?: number, hardMemoryLimit?: number } (in bytes)
+        MemoryBudget memory_budget;
+        memory_budget.soft_limit = internal::Settings::get_worker_memory_soft_limit();
+        memory_budget.hard_limit = internal::Settings::get_worker_memory_hard_limit();
+        if (info.Length() > 1 && info[1]->IsObject())
+        {
+            const v8::Local<v8::Context> context = isolate->GetCurrentContext();
+            const v8::Local<v8::Object> options = info[1].As<v8::Object>();
+            v8::Local<v8::Value> value;
+            int64_t limit;
+            if (options->Get(context, impl::Helper::new_string_ascii(isolate, "softMemoryLimit")).ToLocal(&value) && !value->IsUndefined())
+            {
+                if (!impl::Helper::to_int64(value, limit) || limit < 0)
+                {
+                    jsb_throw(isolate, "bad softMemoryLimit");
+                    return;
+                }
+                memory_budget.soft_limit = (uint64_t) limit;
+            }
+            if (options->Get(context, impl::Helper::new_string_ascii(isolate, "hardMemoryLimit")).ToLocal(&value) && !value->IsUndefined())
+            {
+                if (!impl::Helper::to_int64(value, limit) || limit < 0)
+                {
+                    jsb_throw(isolate, "bad hardMemoryLimit");
+                    return;
+                }
+                memory_budget.hard_limit = (uint64_t) limit;
+            }
+        }
+
         Environment* master = Environment::wrap(isolate);
         Worker* ptr = memnew(Worker);
         const NativeObjectID handle = master->bind_pointer(class_id, NativeClassType::Worker, ptr, self, 0);
         jsb_check(handle);
-        ptr->id_ = Worker::create(master, path, handle);
+        ptr->id_ = Worker::create(master, path, handle, memory_budget);
     }
 
     // placeholder func for ontransfer/onmessage/onready/onerror of worker (in master)
@@ -2,6 +2,7 @@
 #define GODOTJS_WORKER_H
 #include "jsb_bridge_pch.h"
 #include "jsb_buffer.h"
+#include "jsb_memory_budget.h"
 
 #if !JSB_WITH_WEB && !JSB_WITH_JAVASCRIPTCORE
 namespace jsb
@@ -44,7 +45,7 @@ namespace jsb
         static void post_message(const v8::FunctionCallbackInfo<v8::Value>& info);
         static void _placeholder(const v8::FunctionCallbackInfo<v8::Value>& info);
 
-        static WorkerID create(Environment* p_master, const String& p_path, NativeObjectID p_handle);
+        static WorkerID create(Environment* p_master, const String& p_path, NativeObjectID p_handle, const MemoryBudget& p_memory_budget);
 
         // check if a worker valid
         static bool is_valid(WorkerID p_id);
@@ -105,6 +105,12 @@ namespace jsb::impl
             return v8::Local<v8::String>(v8::Data(isolate, stack_pos));
         }
 
+        // value serialization is not supported, always parse the source
+        static v8::MaybeLocal<v8::Value> parse_json_cached(v8::Isolate* isolate, const v8::Local<v8::Context>& context, const uint8_t* p_ptr, size_t p_len, Vector<uint8_t>& r_cache)
+        {
+            return parse_json(isolate, context, p_ptr, p_len);
+        }
+
         // with side effects (may trigger value evaluation).
         // any decoding error will be ignored.
         jsb_force_inline static String to_string_opt(v8::Isolate* isolate, const v8::MaybeLocal<v8::Value>& p_val)
@@ -148,6 +154,11 @@ namespace jsb::impl
         {
         }
 
+        // memory budget is not supported in jsc.impl (no public API to query the heap size)
+        jsb_force_inline static size_t get_memory_used(v8::Isolate* isolate) { return 0; }
+        jsb_force_inline static void set_memory_limit(v8::Isolate* isolate, size_t p_limit) {}
+        jsb_force_inline static bool check_memory_limit_hit(v8::Isolate* isolate) { return false; }
+
         jsb_force_inline static bool to_int64(const v8::Local<v8::Value> p_val, int64_t& r_val)
         {
             if (p_val->IsInt32()) { r_val = p_val.As<v8::Int32>()->Value(); return true; }
@@ -203,6 +214,12 @@ namespace jsb::impl
             return compile_function(context, p_source, p_source_len, p_filename);
         }
 
+        // code caching is not supported, always compile from the source
+        static v8::MaybeLocal<v8::Value> compile_function_cached(const v8::Local<v8::Context>& context, const char* p_source, int p_source_len, const String& p_filename, Vector<uint8_t>& r_cache)
+        {
+            return compile_function(context, p_source, p_source_len, p_filename);
+        }
+
         jsb_force_inline static void free(uint8_t* data)
         {
             //NOTE not a good practice, just for the simplicity of Buffer (to move/free by Buffer)
@@ -213,6 +230,12 @@ namespace jsb::impl
         {
             JSB_JSC_LOG(Error, "set_as_interruptible is not supported by JSC");
         }
+
+        // not supported yet, fallback to the stacktrace of an error
+        jsb_force_inline static int capture_stack_frames(v8::Isolate* isolate, internal::SourcePosition* r_frames, int p_max_depth)
+        {
+            return -1;
+        }
     };
 }
 
@@ -21,12 +21,21 @@ namespace v8
 
     Local<ArrayBuffer> ArrayBuffer::New(Isolate* isolate, size_t length)
     {
-        uint8_t* buf = (uint8_t*) memalloc(length);
-        return Local<ArrayBuffer>(v8::Data(isolate, isolate->push_steal(JS_NewArrayBuffer(isolate->ctx(), buf, length, _free, nullptr, 0))));
+        //NOTE the content is left uninitialized (it's always overwritten by the callers in bridge)
+        // the length is passed as opaque, since the allocator requires it on freeing
+        Allocator* allocator = isolate->get_array_buffer_allocator();
+        uint8_t* buf = (uint8_t*) (allocator ? allocator->AllocateUninitialized(length) : memalloc(length));
+        return Local<ArrayBuffer>(v8::Data(isolate, isolate->push_steal(JS_NewArrayBuffer(isolate->ctx(), buf, length, _free, (void*) (uintptr_t) length, 0))));
     }
 
     void ArrayBuffer::_free(JSRuntime* rt, void* opaque, void* ptr)
     {
+        const Isolate* isolate = (const Isolate*) JS_GetRuntimeOpaque(rt);
+        if (Allocator* allocator = isolate->get_array_buffer_allocator())
+        {
+            allocator->Free(ptr, (size_t) (uintptr_t) opaque);
+            return;
+        }
         memfree(ptr);
     }
 
@@ -74,6 +74,22 @@ namespace jsb::impl
             return String();
         }
 
+        static String GetString(JSContext* ctx, JSAtom atom)
+        {
+            if (atom == JS_ATOM_NULL) return String();
+            if (const char* str = JS_AtomToCString(ctx, atom))
+            {
+                const String rval = String::utf8(str);
+                JS_FreeCString(ctx, str);
+                return rval;
+            }
+
+            // silently ignore the error
+            const JSValue val = JS_GetException(ctx);
+            JS_FreeValue(ctx, val);
+            return String();
+        }
+
         static bool Equals(JSValueConst a, JSValueConst b)
         {
             if (JS_VALUE_GET_TAG(a) != JS_VALUE_GET_TAG(b)) return false;
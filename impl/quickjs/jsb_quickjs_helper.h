@@ -87,8 +87,14 @@ namespace jsb::impl
 
         jsb_force_inline static v8::Local<v8::String> new_string(v8::Isolate* isolate, const String& p_str)
         {
+#if JSB_PREFER_QUICKJS_NG
             const CharString str8 = p_str.utf8();
             const uint16_t stack_pos = isolate->push_steal(JS_NewStringLen(isolate->ctx(), str8.get_data(), str8.length()));
+#else
+            // build the latin1/UTF-16 string directly from UTF-32 (no intermediate UTF-8 buffer)
+            static_assert(sizeof(char32_t) == sizeof(uint32_t));
+            const uint16_t stack_pos = isolate->push_steal(JS_NewStringUTF32(isolate->ctx(), (const uint32_t*) p_str.ptr(), p_str.length()));
+#endif
             return v8::Local<v8::String>(v8::Data(isolate, stack_pos));
         }
 
@@ -109,6 +115,41 @@ namespace jsb::impl
             return v8::MaybeLocal<v8::Value>(v8::Data(isolate, isolate->push_steal(rval)));
         }
 
+        // same as `parse_json`, but reads the value serialized in `r_cache` if not empty, or produces it.
+        // the serialized value is not bound to a runtime, it could be reused by all environments in the process (see `JsonModuleCache`).
+        static v8::MaybeLocal<v8::Value> parse_json_cached(v8::Isolate* isolate, const v8::Local<v8::Context>& context, const uint8_t* p_ptr, size_t p_len, Vector<uint8_t>& r_cache)
+        {
+            JSContext* ctx = isolate->ctx();
+            if (!r_cache.is_empty())
+            {
+                const JSValue rval = JS_ReadObject(ctx, r_cache.ptr(), r_cache.size(), 0);
+                if (!JS_IsException(rval))
+                {
+                    return v8::MaybeLocal<v8::Value>(v8::Data(isolate, isolate->push_steal(rval)));
+                }
+
+                // rejected, parse it again and regenerate the cache
+                JS_FreeValue(ctx, JS_GetException(ctx));
+                r_cache.clear();
+            }
+
+            jsb_check(p_ptr[p_len] == '\0');
+            const JSValue rval = JS_ParseJSON(ctx, (const char*) p_ptr, p_len, "<string>");
+            if (JS_IsException(rval))
+            {
+                // intentionally keep the exception
+                return v8::MaybeLocal<v8::Value>();
+            }
+            size_t size = 0;
+            if (uint8_t* data = JS_WriteObject(ctx, &size, rval, 0))
+            {
+                r_cache.resize((int64_t) size);
+                memcpy(r_cache.ptrw(), data, size);
+                js_free(ctx, data);
+            }
+            return v8::MaybeLocal<v8::Value>(v8::Data(isolate, isolate->push_steal(rval)));
+        }
+
         // with side effects (may trigger value evaluation).
         // any decoding error will be ignored.
         jsb_force_inline static String to_string_opt(v8::Isolate* isolate, const v8::MaybeLocal<v8::Value>& p_val)
@@ -122,6 +163,16 @@ namespace jsb::impl
         {
             if (!p_val.IsEmpty() && !p_val->IsNullOrUndefined())
             {
+#if !JSB_PREFER_QUICKJS_NG
+                // read the characters of string values directly, other values are converted with `ToString` below
+                const void* buf;
+                uint32_t len32;
+                JS_BOOL wide;
+                if (JS_GetStringBuffer(isolate->ctx(), (JSValue) p_val, &buf, &len32, &wide))
+                {
+                    return wide ? from_utf16((const uint16_t*) buf, len32) : from_latin1((const uint8_t*) buf, len32);
+                }
+#endif
                 size_t len;
                 if (const char* str = JS_ToCStringLen(isolate->ctx(), &len, (JSValue) p_val))
                 {
@@ -134,6 +185,40 @@ namespace jsb::impl
             return String();
         }
 
+        static String from_latin1(const uint8_t* p_chars, uint32_t p_len)
+        {
+            String ret;
+            if (p_len == 0) return ret;
+            ret.resize((int) p_len + 1);
+            char32_t* dst = ret.ptrw();
+            for (uint32_t i = 0; i < p_len; ++i) dst[i] = p_chars[i];
+            dst[p_len] = 0;
+            return ret;
+        }
+
+        // unlike `String::utf16`, a leading U+FEFF is not treated as a BOM, and unpaired surrogates are kept as is
+        static String from_utf16(const uint16_t* p_chars, uint32_t p_len)
+        {
+            String ret;
+            if (p_len == 0) return ret;
+            // the number of code points is at most the number of code units
+            ret.resize((int) p_len + 1);
+            char32_t* dst = ret.ptrw();
+            uint32_t n = 0;
+            for (uint32_t i = 0; i < p_len; ++i)
+            {
+                uint32_t c = p_chars[i];
+                if (c >= 0xd800 && c < 0xdc00 && i + 1 < p_len && p_chars[i + 1] >= 0xdc00 && p_chars[i + 1] < 0xe000)
+                {
+                    c = 0x10000 + ((c - 0xd800) << 10) + (p_chars[++i] - 0xdc00);
+                }
+                dst[n++] = c;
+            }
+            dst[n] = 0;
+            if (n != p_len) ret.resize((int) n + 1);
+            return ret;
+        }
+
         static String to_string_without_side_effect(v8::Isolate* isolate, const v8::Local<v8::Value>& p_val)
         {
             if (!p_val.IsEmpty())
@@ -184,6 +269,15 @@ namespace jsb::impl
             p_fields.append(CustomField::value_i64(jsb_nameof(JSMemoryUsage, c_func_count), usage.c_func_count));
         }
 
+        // bytes used by the JS heap (0 if not supported by the runtime)
+        jsb_force_inline static size_t get_memory_used(v8::Isolate* isolate) { return isolate->get_memory_used(); }
+
+        // hard limit of the JS heap (0 for unlimited), allocations beyond it fail as out of memory errors
+        jsb_force_inline static void set_memory_limit(v8::Isolate* isolate, size_t p_limit) { isolate->set_memory_limit(p_limit); }
+
+        // check (and reset) if any allocation failed due to the memory limit since the last check
+        jsb_force_inline static bool check_memory_limit_hit(v8::Isolate* isolate) { return isolate->check_memory_limit_hit(); }
+
         jsb_force_inline static bool to_int64(const v8::Local<v8::Value> p_val, int64_t& r_val)
         {
             if (p_val->IsInt32()) { r_val = p_val.As<v8::Int32>()->Value(); return true; }
@@ -232,6 +326,49 @@ namespace jsb::impl
             return compile_function(context, p_source, p_source_len, p_filename);
         }
 
+        // same as `compile_function`, but evaluates the bytecode in `r_cache` if not empty, or produces it.
+        // the bytecode is not bound to a runtime, it could be reused by all environments in the process (see `BootstrapCache`).
+        static v8::MaybeLocal<v8::Value> compile_function_cached(const v8::Local<v8::Context>& context, const char* p_source, int p_source_len, const String& p_filename, Vector<uint8_t>& r_cache)
+        {
+            v8::Isolate* isolate = context->GetIsolate();
+            JSContext* ctx = isolate->ctx();
+            JSValue bytecode;
+            if (!r_cache.is_empty())
+            {
+                bytecode = JS_ReadObject(ctx, r_cache.ptr(), r_cache.size(), JS_READ_OBJ_BYTECODE);
+            }
+            else
+            {
+                jsb_checkf(p_source[p_source_len] == '\0', "JS_Eval needs a zero-terminated string as input to evaluate");
+                const CharString filename = p_filename.utf8();
+                constexpr int flags = JS_EVAL_TYPE_GLOBAL | JS_EVAL_FLAG_STRICT | JS_EVAL_FLAG_COMPILE_ONLY;
+                bytecode = JS_Eval(ctx, p_source, p_source_len, filename.get_data(), flags);
+                if (!JS_IsException(bytecode))
+                {
+                    size_t size = 0;
+                    if (uint8_t* data = JS_WriteObject(ctx, &size, bytecode, JS_WRITE_OBJ_BYTECODE))
+                    {
+                        r_cache.resize((int64_t) size);
+                        memcpy(r_cache.ptrw(), data, size);
+                        js_free(ctx, data);
+                    }
+                }
+            }
+            if (JS_IsException(bytecode))
+            {
+                // intentionally keep the exception
+                return v8::MaybeLocal<v8::Value>();
+            }
+
+            // the bytecode object is freed by JS_EvalFunction
+            const JSValue rval = JS_EvalFunction(ctx, bytecode);
+            if (JS_IsException(rval))
+            {
+                return v8::MaybeLocal<v8::Value>();
+            }
+            return v8::MaybeLocal<v8::Value>(v8::Data(isolate, isolate->push_steal(rval)));
+        }
+
         jsb_force_inline static void free(uint8_t* data)
         {
             // js_free(context->GetIsolate()->ctx(), data);
@@ -248,6 +385,29 @@ namespace jsb::impl
         {
             isolate->set_as_interruptible();
         }
+
+        // capture the raw stack frames (untranslated) without throwing an error.
+        // return -1 if it's not supported, the caller should fallback to the stacktrace of an error.
+        static int capture_stack_frames(v8::Isolate* isolate, internal::SourcePosition* r_frames, int p_max_depth)
+        {
+#if JSB_PREFER_QUICKJS_NG
+            return -1;
+#else
+            JSContext* ctx = isolate->ctx();
+            JSStackFrameInfo* frames = jsb_stackalloc(JSStackFrameInfo, p_max_depth);
+            const int num = JS_GetStackFrames(ctx, frames, p_max_depth);
+            for (int index = 0; index < num; ++index)
+            {
+                const JSStackFrameInfo& info = frames[index];
+                internal::SourcePosition& frame = r_frames[index];
+                frame.function = QuickJS::GetString(ctx, info.func_name);
+                frame.filename = QuickJS::GetString(ctx, info.filename);
+                frame.line = info.line_num;
+                frame.column = 0;
+            }
+            return num;
+#endif
+        }
     };
 }
 
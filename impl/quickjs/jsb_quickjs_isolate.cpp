@@ -21,15 +21,55 @@ namespace v8
             return val;
         }
 
+        // prepended to each allocation to track the memory usage of the isolate (16 bytes to keep the alignment)
+        struct AllocationHeader
+        {
+            size_t size;
+            size_t padding;
+        };
+        static_assert(sizeof(AllocationHeader) == 16);
+
+        jsb_force_inline static AllocationHeader* get_header(const void* ptr)
+        {
+            return (AllocationHeader*) ((uint8_t*) ptr - sizeof(AllocationHeader));
+        }
+
+        static size_t js_malloc_usable_size(const void* ptr)
+        {
+            return ptr ? get_header(ptr)->size : 0;
+        }
+
 #if JSB_PREFER_QUICKJS_NG
+        // NOTE: the memory limit is enforced here instead of JS_SetMemoryLimit,
+        //       since quickjs-ng checks it before calling the hooks (the isolate would never know the limit is hit).
         static void* js_calloc(void* opaque, size_t count, size_t size)
         {
-            return ::calloc(count, size);
+            if (size != 0 && count > (SIZE_MAX - sizeof(AllocationHeader)) / size) return nullptr;
+            Isolate* isolate = (Isolate*) opaque;
+            const size_t total = count * size;
+            if (!isolate->_reserve_memory(total + sizeof(AllocationHeader), isolate->memory_limit_)) return nullptr;
+            AllocationHeader* header = (AllocationHeader*) ::calloc(1, sizeof(AllocationHeader) + total);
+            if (!header)
+            {
+                isolate->_release_memory(total + sizeof(AllocationHeader));
+                return nullptr;
+            }
+            header->size = total;
+            return header + 1;
         }
 
         static void* js_malloc(void* opaque, size_t size)
         {
-            return ::malloc(size);
+            Isolate* isolate = (Isolate*) opaque;
+            if (!isolate->_reserve_memory(size + sizeof(AllocationHeader), isolate->memory_limit_)) return nullptr;
+            AllocationHeader* header = (AllocationHeader*) ::malloc(sizeof(AllocationHeader) + size);
+            if (!header)
+            {
+                isolate->_release_memory(size + sizeof(AllocationHeader));
+                return nullptr;
+            }
+            header->size = size;
+            return header + 1;
         }
 
         static void js_free(void* opaque, void* ptr)
@@ -37,7 +77,9 @@ namespace v8
             // avoid error prints on nullptr
             if (ptr)
             {
-                ::free(ptr);
+                AllocationHeader* header = get_header(ptr);
+                ((Isolate*) opaque)->_release_memory(header->size + sizeof(AllocationHeader));
+                ::free(header);
 
                 // it's dangerous, but, just haven't found a better solution
                 ((Isolate*) opaque)->_invalidate_phantom(ptr);
@@ -49,17 +91,39 @@ namespace v8
             //TODO JSObject would never be reallocated, true?
             //     (otherwise, we need an indirect way to map it in Global handle, and remap it in Isolate on it reallocated)
             // jsb_check(!((Isolate*) s->opaque)->_has_phantom(ptr));
-            return ::realloc(ptr, size);
-        }
-
-        static size_t js_malloc_usable_size(const void* ptr)
-        {
-            return 0;
+            if (!ptr) return js_malloc(opaque, size);
+
+            Isolate* isolate = (Isolate*) opaque;
+            AllocationHeader* header = get_header(ptr);
+            const size_t old_size = header->size;
+            if (size > old_size && !isolate->_reserve_memory(size - old_size, isolate->memory_limit_)) return nullptr;
+            header = (AllocationHeader*) ::realloc(header, sizeof(AllocationHeader) + size);
+            if (!header)
+            {
+                if (size > old_size) isolate->_release_memory(size - old_size);
+                return nullptr;
+            }
+            if (size < old_size) isolate->_release_memory(old_size - size);
+            header->size = size;
+            return header + 1;
         }
 #else
+        // NOTE: the default malloc functions of quickjs are replaced,
+        //       so the accounting in JSMallocState and the check of `malloc_limit` (set by JS_SetMemoryLimit) are done here.
         static void* js_malloc(JSMallocState* s, size_t size)
         {
-            return memalloc(size);
+            Isolate* isolate = (Isolate*) s->opaque;
+            if (!isolate->_reserve_memory(size + sizeof(AllocationHeader), s->malloc_limit)) return nullptr;
+            AllocationHeader* header = (AllocationHeader*) memalloc(sizeof(AllocationHeader) + size);
+            if (!header)
+            {
+                isolate->_release_memory(size + sizeof(AllocationHeader));
+                return nullptr;
+            }
+            header->size = size;
+            s->malloc_count++;
+            s->malloc_size += size + sizeof(AllocationHeader);
+            return header + 1;
         }
 
         static void js_free(JSMallocState* s, void* ptr)
@@ -67,7 +131,11 @@ namespace v8
             // avoid error prints on nullptr
             if (ptr)
             {
-                memfree(ptr);
+                AllocationHeader* header = get_header(ptr);
+                s->malloc_count--;
+                s->malloc_size -= header->size + sizeof(AllocationHeader);
+                ((Isolate*) s->opaque)->_release_memory(header->size + sizeof(AllocationHeader));
+                memfree(header);
 
                 // it's dangerous, but, just haven't found a better solution
                 ((Isolate*) s->opaque)->_invalidate_phantom(ptr);
@@ -79,7 +147,30 @@ namespace v8
             //TODO JSObject would never be reallocated, true?
             //     (otherwise, we need an indirect way to map it in Global handle, and remap it in Isolate on it reallocated)
             // jsb_check(!((Isolate*) s->opaque)->_has_phantom(ptr));
-            return memrealloc(ptr, size);
+            if (!ptr)
+            {
+                return size == 0 ? nullptr : js_malloc(s, size);
+            }
+            if (size == 0)
+            {
+                js_free(s, ptr);
+                return nullptr;
+            }
+
+            Isolate* isolate = (Isolate*) s->opaque;
+            AllocationHeader* header = get_header(ptr);
+            const size_t old_size = header->size;
+            if (size > old_size && !isolate->_reserve_memory(size - old_size, s->malloc_limit)) return nullptr;
+            header = (AllocationHeader*) memrealloc(header, sizeof(AllocationHeader) + size);
+            if (!header)
+            {
+                if (size > old_size) isolate->_release_memory(size - old_size);
+                return nullptr;
+            }
+            if (size < old_size) isolate->_release_memory(old_size - size);
+            s->malloc_size += size - old_size;
+            header->size = size;
+            return header + 1;
         }
 #endif
 
@@ -90,6 +181,7 @@ namespace v8
     Isolate *Isolate::New(const CreateParams &params)
     {
         Isolate* isolate = memnew(Isolate);
+        isolate->array_buffer_allocator_ = params.array_buffer_allocator;
         return isolate;
     }
 
@@ -98,7 +190,7 @@ namespace v8
 #if JSB_PREFER_QUICKJS_NG
         const JSMallocFunctions mf = { details::js_calloc, details::js_malloc, details::js_free, details::js_realloc, details::js_malloc_usable_size };
 #else
-        const JSMallocFunctions mf = { details::js_malloc, details::js_free, details::js_realloc, nullptr };
+        const JSMallocFunctions mf = { details::js_malloc, details::js_free, details::js_realloc, details::js_malloc_usable_size };
 #endif
         rt_ = JS_NewRuntime2(&mf, this);
         ctx_ = JS_NewContext(rt_);
@@ -289,4 +381,13 @@ namespace v8
         JS_RunGC(rt_);
     }
 
+    void Isolate::set_memory_limit(size_t p_limit)
+    {
+        memory_limit_ = p_limit;
+#if !JSB_PREFER_QUICKJS_NG
+        // checked in the malloc hooks
+        JS_SetMemoryLimit(rt_, p_limit != 0 ? p_limit : (size_t) -1);
+#endif
+    }
+
 }
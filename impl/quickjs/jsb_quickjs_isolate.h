@@ -153,6 +153,23 @@ namespace v8
         jsb_force_inline JSRuntime* rt() const { return rt_; }
         jsb_force_inline JSContext* ctx() const { return ctx_; }
 
+        // the allocator for the backing stores of ArrayBuffer (nullptr for the default memalloc/memfree)
+        jsb_force_inline ArrayBuffer::Allocator* get_array_buffer_allocator() const { return array_buffer_allocator_; }
+
+        // bytes allocated by the runtime (tracked by the malloc hooks, including the allocation headers)
+        jsb_force_inline size_t get_memory_used() const { return memory_used_; }
+
+        // allocations beyond the limit fail (thrown as out of memory errors in JS), 0 for unlimited
+        void set_memory_limit(size_t p_limit);
+
+        // check and reset the flag of allocation failures caused by the memory limit
+        bool check_memory_limit_hit()
+        {
+            const bool hit = memory_limit_hit_;
+            memory_limit_hit_ = false;
+            return hit;
+        }
+
         jsb::impl::InternalDataConstPtr get_internal_data(const jsb::impl::InternalDataID index) const
         {
             return internal_data_.get_value_scoped(index);
@@ -337,6 +354,25 @@ namespace v8
         // [internal]
         bool _has_phantom(void* token) const { return phantom_.has(token); }
 
+        // [internal] account an allocation in the malloc hooks, return false if the memory limit is hit
+        jsb_force_inline bool _reserve_memory(size_t p_size, size_t p_limit)
+        {
+            if (jsb_unlikely(p_limit != 0 && memory_used_ + p_size > p_limit))
+            {
+                memory_limit_hit_ = true;
+                return false;
+            }
+            memory_used_ += p_size;
+            return true;
+        }
+
+        // [internal]
+        jsb_force_inline void _release_memory(size_t p_size)
+        {
+            jsb_check(memory_used_ >= p_size);
+            memory_used_ -= p_size;
+        }
+
         // [internal]
         jsb_force_inline void _invalidate_phantom(void* token)
         {
@@ -410,6 +446,12 @@ namespace v8
         void* embedder_data_ = nullptr;
         void* context_embedder_data_ = nullptr;
 
+        ArrayBuffer::Allocator* array_buffer_allocator_ = nullptr;
+
+        size_t memory_used_ = 0;
+        size_t memory_limit_ = 0;
+        bool memory_limit_hit_ = false;
+
         SafeFlag interrupted_ = SafeFlag(false);
     };
 }
@@ -310,6 +310,7 @@ namespace v8
         int flags = 0;
         if ((filter & SKIP_STRINGS) == 0) flags |= JS_GPN_STRING_MASK;
         if ((filter & SKIP_SYMBOLS) == 0) flags |= JS_GPN_SYMBOL_MASK;
+        if (filter & ONLY_ENUMERABLE) flags |= JS_GPN_ENUM_ONLY;
 
         // key_conversion is not available in quickjs.impl
         jsb_check(key_conversion == v8::KeyConversionMode::kNoNumbers);
@@ -113,6 +113,12 @@ namespace jsb::impl
             return v8::JSON::Parse(context, json_string);
         }
 
+        // JSON.parse is faster than ValueDeserializer for the plain data, always parse the source
+        static v8::MaybeLocal<v8::Value> parse_json_cached(v8::Isolate* isolate, const v8::Local<v8::Context>& context, const uint8_t* p_ptr, size_t p_len, Vector<uint8_t>& r_cache)
+        {
+            return parse_json(isolate, context, p_ptr, p_len);
+        }
+
         jsb_force_inline static bool to_int64(const v8::Local<v8::Value> p_val, int64_t& r_val)
         {
             if (p_val->IsInt32()) { r_val = p_val.As<v8::Int32>()->Value(); return true; }
@@ -159,16 +165,7 @@ namespace jsb::impl
             }
             else
             {
-#if JSB_WITH_URI_SCRIPT_ORIGIN
-                const String prefixed = "file://" + p_filename;
-                const CharString filename = prefixed.utf8();
-#else
-#ifdef WINDOWS_ENABLED
-                const CharString filename = p_filename.replace("/", "\\").utf8();
-#else
-                const CharString filename = p_filename.utf8();
-#endif
-#endif
+                const CharString filename = get_origin_name(p_filename);
                 v8::ScriptOrigin origin(isolate, v8::String::NewFromUtf8(isolate, filename.get_data(), v8::NewStringType::kNormal, filename.length()).ToLocalChecked());
                 script = v8::Script::Compile(context, source, &origin);
             }
@@ -193,6 +190,55 @@ namespace jsb::impl
             return compile_function(context, p_source, p_source_len, p_filename);
         }
 
+        // same as `compile_function`, but consumes the code cache in `r_cache` if not empty, or produces it (after the script run).
+        // the cache is not bound to an isolate, it could be reused by all environments in the process (see `BootstrapCache`).
+        static v8::MaybeLocal<v8::Value> compile_function_cached(const v8::Local<v8::Context>& context, const char* p_source, int p_source_len, const String& p_filename, Vector<uint8_t>& r_cache)
+        {
+            v8::Isolate* isolate = context->GetIsolate();
+            const v8::Local<v8::String> source_str = v8::String::NewFromUtf8(isolate, p_source, v8::NewStringType::kNormal, p_source_len).ToLocalChecked();
+            const CharString filename = get_origin_name(p_filename);
+            const v8::ScriptOrigin origin(isolate, v8::String::NewFromUtf8(isolate, filename.get_data(), v8::NewStringType::kNormal, filename.length()).ToLocalChecked());
+
+            const bool consume = !r_cache.is_empty();
+            v8::ScriptCompiler::Source source = consume
+                ? v8::ScriptCompiler::Source(source_str, origin, new v8::ScriptCompiler::CachedData(r_cache.ptr(), r_cache.size()))
+                : v8::ScriptCompiler::Source(source_str, origin);
+            v8::Local<v8::Script> script;
+            if (!v8::ScriptCompiler::Compile(context, &source, consume ? v8::ScriptCompiler::kConsumeCodeCache : v8::ScriptCompiler::kNoCompileOptions).ToLocal(&script))
+            {
+                return {};
+            }
+            const bool rejected = consume && source.GetCachedData()->rejected;
+
+            const v8::MaybeLocal<v8::Value> maybe_value = script->Run(context);
+            if (maybe_value.IsEmpty())
+            {
+                return {};
+            }
+
+            // (re)generate the cache after running, the functions compiled lazily in running are also included
+            if (!consume || rejected)
+            {
+                const std::unique_ptr<v8::ScriptCompiler::CachedData> data(v8::ScriptCompiler::CreateCodeCache(script->GetUnboundScript()));
+                r_cache.resize(data ? data->length : 0);
+                if (data) memcpy(r_cache.ptrw(), data->data, data->length);
+            }
+            return maybe_value;
+        }
+
+        static CharString get_origin_name(const String& p_filename)
+        {
+#if JSB_WITH_URI_SCRIPT_ORIGIN
+            return ("file://" + p_filename).utf8();
+#else
+#ifdef WINDOWS_ENABLED
+            return p_filename.replace("/", "\\").utf8();
+#else
+            return p_filename.utf8();
+#endif
+#endif
+        }
+
         template<int N>
         jsb_force_inline static void throw_error(v8::Isolate* isolate, const char (&message)[N])
         {
@@ -221,7 +267,37 @@ namespace jsb::impl
             p_fields.append(CustomField::value_u64("external_memory", v8_statistics.external_memory()));
         }
 
+        // bytes used by the JS heap (0 if not supported by the runtime)
+        jsb_force_inline static size_t get_memory_used(v8::Isolate* isolate)
+        {
+            v8::HeapStatistics v8_statistics;
+            isolate->GetHeapStatistics(&v8_statistics);
+            return v8_statistics.used_heap_size() + v8_statistics.external_memory();
+        }
+
+        // the v8 heap limit can only be set on creating the isolate, the hard limit is checked on `Environment::update` instead
+        jsb_force_inline static void set_memory_limit(v8::Isolate* isolate, size_t p_limit) {}
+        jsb_force_inline static bool check_memory_limit_hit(v8::Isolate* isolate) { return false; }
+
         jsb_force_inline static void set_as_interruptible(v8::Isolate* isolate) {}
+
+        // capture the raw stack frames (untranslated) without throwing an error.
+        // return -1 if it's not supported, the caller should fallback to the stacktrace of an error.
+        static int capture_stack_frames(v8::Isolate* isolate, internal::SourcePosition* r_frames, int p_max_depth)
+        {
+            const v8::Local<v8::StackTrace> stack_trace = v8::StackTrace::CurrentStackTrace(isolate, p_max_depth, v8::StackTrace::kOverview);
+            const int num = MIN(stack_trace->GetFrameCount(), p_max_depth);
+            for (int index = 0; index < num; ++index)
+            {
+                const v8::Local<v8::StackFrame> info = stack_trace->GetFrame(isolate, index);
+                internal::SourcePosition& frame = r_frames[index];
+                frame.function = to_string(isolate, info->GetFunctionName());
+                frame.filename = to_string(isolate, info->GetScriptName());
+                frame.line = info->GetLineNumber();
+                frame.column = info->GetColumn();
+            }
+            return num;
+        }
     };
 }
 
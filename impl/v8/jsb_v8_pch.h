@@ -9,6 +9,7 @@
 
 #include "../../internal/jsb_logger.h"
 #include "../../internal/jsb_macros.h"
+#include "../../internal/jsb_source_map.h"
 
 #include "../shared/jsb_custom_field.h"
 
@@ -104,6 +104,12 @@ namespace jsb::impl
             return v8::MaybeLocal<v8::Value>(v8::Data(isolate, rval_sp));
         }
 
+        // value serialization is not supported, always parse the source
+        static v8::MaybeLocal<v8::Value> parse_json_cached(v8::Isolate* isolate, const v8::Local<v8::Context>& context, const uint8_t* p_ptr, size_t p_len, Vector<uint8_t>& r_cache)
+        {
+            return parse_json(isolate, context, p_ptr, p_len);
+        }
+
         // with side effects (may trigger value evaluation).
         // any decoding error will be ignored.
         jsb_force_inline static String to_string_opt(v8::Isolate* isolate, const v8::MaybeLocal<v8::Value>& p_val)
@@ -167,6 +173,11 @@ namespace jsb::impl
             p_fields.append(CustomField::value_i64("registered_object_count", (int64_t) usage.registered_object_count));
         }
 
+        // memory budget is not supported in web.impl (the heap is managed by the browser)
+        jsb_force_inline static size_t get_memory_used(v8::Isolate* isolate) { return 0; }
+        jsb_force_inline static void set_memory_limit(v8::Isolate* isolate, size_t p_limit) {}
+        jsb_force_inline static bool check_memory_limit_hit(v8::Isolate* isolate) { return false; }
+
         jsb_force_inline static bool to_int64(const v8::Local<v8::Value> p_val, int64_t& r_val)
         {
             if (p_val->IsInt32()) { r_val = p_val.As<v8::Int32>()->Value(); return true; }
@@ -208,6 +219,12 @@ namespace jsb::impl
             return v8::MaybeLocal<v8::Value>(v8::Data(isolate, rval_sp));
         }
 
+        // code caching is not supported, always compile from the source
+        static v8::MaybeLocal<v8::Value> compile_function_cached(const v8::Local<v8::Context>& context, const char* p_source, int p_source_len, const String& p_filename, Vector<uint8_t>& r_cache)
+        {
+            return compile_function(context, p_source, p_source_len, p_filename);
+        }
+
         static v8::MaybeLocal<v8::Value> eval(const v8::Local<v8::Context>& context, const char* p_source, int p_source_len, const String& p_filename)
         {
             jsb_checkf(p_source[p_source_len] == '\0', "needs a zero-terminated string as input to evaluate");
@@ -232,6 +249,12 @@ namespace jsb::impl
         {
             isolate->set_as_interruptible();
         }
+
+        // not supported yet, fallback to the stacktrace of an error
+        jsb_force_inline static int capture_stack_frames(v8::Isolate* isolate, internal::SourcePosition* r_frames, int p_max_depth)
+        {
+            return -1;
+        }
     };
 }
 
@@ -0,0 +1,373 @@
+#include "jsb_async_logger.h"
+#include "jsb_console_output.h"
+#include "jsb_source_map_cache.h"
+#include "jsb_thread_util.h"
+#include "jsb_settings.h"
+#include "jsb_logger.h"
+
+#include "core/io/logger.h"
+#include "core/os/semaphore.h"
+
+namespace jsb::internal
+{
+    namespace
+    {
+        struct AsyncLoggerState
+        {
+            BinaryMutex lock;
+            std::vector<std::shared_ptr<LogQueue>> queues;
+
+            Thread thread;
+            Semaphore semaphore;
+            SafeFlag running = SafeFlag(false);
+            SafeFlag interrupt_requested = SafeFlag(false);
+
+            // the error hooks are installed once for the process
+            bool hooks_installed = false;
+        };
+
+        // set while the current thread holds a logger lock (queue consumer lock or the state lock),
+        // an error printed in the meantime must not try to lock them again from `flush_on_error`.
+        thread_local bool tl_in_logger = false;
+
+        struct InLoggerScope
+        {
+            const bool previous = tl_in_logger;
+            InLoggerScope() { tl_in_logger = true; }
+            ~InLoggerScope() { tl_in_logger = previous; }
+        };
+
+        AsyncLoggerState& get_state()
+        {
+            static AsyncLoggerState state;
+            return state;
+        }
+
+        void flush_all(AsyncLoggerState& p_state)
+        {
+            // copy to avoid holding the lock while writing (console outputs may be slow)
+            std::vector<std::shared_ptr<LogQueue>> queues;
+            {
+                InLoggerScope scope;
+                MutexLock lock(p_state.lock);
+                queues = p_state.queues;
+            }
+            for (const std::shared_ptr<LogQueue>& queue : queues)
+            {
+                queue->drain();
+            }
+        }
+
+        // notified on every error output of the engine, including the fatal errors and the crash handler
+        class FlushOnErrorLogger : public Logger
+        {
+        public:
+            virtual void logv(const char* p_format, va_list p_list, bool p_err) override
+            {
+                if (p_err)
+                {
+                    AsyncLogger::flush_on_error();
+                }
+            }
+        };
+
+        void _flush_at_exit()
+        {
+            AsyncLogger::flush_on_error();
+        }
+
+        void install_hooks(AsyncLoggerState& p_state)
+        {
+            // OS loggers are not thread safe to modify, leave it to the main thread
+            if (p_state.hooks_installed || Thread::get_caller_id() != Thread::get_main_id()) return;
+
+            p_state.hooks_installed = true;
+            OS::get_singleton()->add_logger(memnew(FlushOnErrorLogger));
+            std::atexit(_flush_at_exit);
+        }
+
+        void _flush_thread_run(void* p_data)
+        {
+            AsyncLoggerState& state = *(AsyncLoggerState*) p_data;
+            ThreadUtil::set_name("JSLogger");
+            while (true)
+            {
+                // woken up by the producers when a queue becomes non-empty (see `LogQueue::push`)
+                state.semaphore.wait();
+                flush_all(state);
+                if (state.interrupt_requested.is_set())
+                {
+                    break;
+                }
+            }
+        }
+    }
+
+    void LogEntry::resolve(SourceMapCache* p_source_map_cache)
+    {
+        if (frames.is_empty()) return;
+
+        SourcePosition* ptr = frames.ptrw();
+        const int num = (int) frames.size();
+        if (p_source_map_cache)
+        {
+            for (int index = 0; index < num; ++index)
+            {
+                p_source_map_cache->translate(ptr[index]);
+            }
+        }
+        position = ptr[0];
+        if (with_stacktrace)
+        {
+            text += "\n";
+            text += SourceMapCache::format_stacktrace(ptr, num);
+        }
+        frames.clear();
+    }
+
+    void LogEntry::emit(const LogEntry& p_entry)
+    {
+        IConsoleOutput::internal_write(p_entry.severity, p_entry.text);
+        if (p_entry.severity == ELogSeverity::Warning || p_entry.severity >= ELogSeverity::Error)
+        {
+            const CharString func_str = p_entry.position.function.utf8();
+            const CharString filename_str = p_entry.position.filename.utf8();
+            const CharString text_str = p_entry.text.utf8();
+            const bool is_warning = p_entry.severity == ELogSeverity::Warning;
+            _err_print_error(
+                func_str.get_data(), filename_str.get_data(), p_entry.position.line,
+                text_str.get_data(),
+                !is_warning, is_warning ? ERR_HANDLER_WARNING : ERR_HANDLER_ERROR);
+            return;
+        }
+        print_line(p_entry.text);
+    }
+
+    LogQueue::LogQueue(uint32_t p_capacity, uint32_t p_rate_limit, SourceMapCache* p_source_map_cache)
+        : source_map_cache_(p_source_map_cache)
+    {
+        for (int index = 0; index < ELogSeverity::Warning; ++index)
+        {
+            rate_limits_[index] = p_rate_limit;
+        }
+        const uint32_t capacity = next_power_of_2(MAX(p_capacity, 16u));
+        slots_ = memnew_arr(LogEntry, capacity);
+        mask_ = capacity - 1;
+    }
+
+    LogQueue::~LogQueue()
+    {
+        jsb_check(is_empty());
+        memdelete_arr(slots_);
+    }
+
+    void LogQueue::set_rate_limit(ELogSeverity::Type p_severity, uint32_t p_rate_limit)
+    {
+        rate_limits_[p_severity] = p_rate_limit;
+        rate_windows_[p_severity] = RateWindow();
+    }
+
+    bool LogQueue::is_rate_limited(ELogSeverity::Type p_severity)
+    {
+        const uint32_t rate_limit = rate_limits_[p_severity];
+        if (rate_limit == 0) return false;
+
+        RateWindow& window = rate_windows_[p_severity];
+        const uint64_t now = OS::get_singleton()->get_ticks_msec();
+        if (now - window.start_msec >= 1000)
+        {
+            window.start_msec = now;
+            window.count = 0;
+        }
+        return ++window.count > rate_limit;
+    }
+
+    bool LogQueue::push(LogEntry&& p_entry)
+    {
+        if (jsb_unlikely(is_rate_limited(p_entry.severity)))
+        {
+            rate_limited_.fetch_add(1, std::memory_order_relaxed);
+            dropped_.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+
+        const uint32_t head = head_.load(std::memory_order_relaxed);
+        if (jsb_unlikely(head - tail_.load(std::memory_order_acquire) > mask_))
+        {
+            dropped_.fetch_add(1, std::memory_order_relaxed);
+            AsyncLogger::notify();
+            return false;
+        }
+
+        slots_[head & mask_] = std::move(p_entry);
+        pushed_.fetch_add(1, std::memory_order_relaxed);
+
+        // wake up the flush thread only if the consumer has caught up with all previous entries (it may be waiting).
+        // otherwise, the consumer is still draining and will see the new entry when re-checking `head_` (both sides are seq_cst).
+        head_.store(head + 1, std::memory_order_seq_cst);
+        if (tail_.load(std::memory_order_seq_cst) == head)
+        {
+            AsyncLogger::notify();
+        }
+        return true;
+    }
+
+    int LogQueue::drain_locked()
+    {
+        int num = 0;
+        uint32_t tail = tail_.load(std::memory_order_relaxed);
+        while (tail != head_.load(std::memory_order_seq_cst))
+        {
+            LogEntry& slot = slots_[tail & mask_];
+            slot.resolve(source_map_cache_);
+            LogEntry::emit(slot);
+            // release the strings in the consumer, so that the producer does not pay for it
+            slot = LogEntry();
+            tail_.store(++tail, std::memory_order_seq_cst);
+            ++num;
+        }
+
+        if (const uint64_t dropped = dropped_.load(std::memory_order_relaxed); jsb_unlikely(dropped != reported_dropped_))
+        {
+            LogEntry entry;
+            entry.severity = ELogSeverity::Warning;
+            entry.text = jsb_format("[JS] %d log messages dropped (buffer full or rate limited)", dropped - reported_dropped_);
+            reported_dropped_ = dropped;
+            LogEntry::emit(entry);
+        }
+        return num;
+    }
+
+    int LogQueue::drain()
+    {
+        InLoggerScope scope;
+        MutexLock lock(consumer_lock_);
+        return drain_locked();
+    }
+
+    int LogQueue::try_drain()
+    {
+        InLoggerScope scope;
+        if (!consumer_lock_.try_lock()) return -1;
+        const int num = drain_locked();
+        consumer_lock_.unlock();
+        return num;
+    }
+
+    void LogQueue::emit_sync(LogEntry& p_entry)
+    {
+        InLoggerScope scope;
+        MutexLock lock(consumer_lock_);
+        drain_locked();
+        p_entry.resolve(source_map_cache_);
+        LogEntry::emit(p_entry);
+    }
+
+    LogQueueStats LogQueue::get_stats() const
+    {
+        LogQueueStats stats;
+        stats.pushed = pushed_.load(std::memory_order_relaxed);
+        stats.dropped = dropped_.load(std::memory_order_relaxed);
+        stats.rate_limited = rate_limited_.load(std::memory_order_relaxed);
+        return stats;
+    }
+
+    std::shared_ptr<LogQueue> AsyncLogger::create_queue(SourceMapCache* p_source_map_cache)
+    {
+        if (!Settings::get_logger_async_enabled())
+        {
+            return nullptr;
+        }
+
+        std::shared_ptr<LogQueue> queue = std::make_shared<LogQueue>(
+            (uint32_t) Settings::get_logger_async_buffer_size(),
+            (uint32_t) Settings::get_logger_async_rate_limit(),
+            p_source_map_cache);
+        queue->set_rate_limit(ELogSeverity::Warning, (uint32_t) Settings::get_logger_async_warning_rate_limit());
+        AsyncLoggerState& state = get_state();
+        InLoggerScope scope;
+        MutexLock lock(state.lock);
+        install_hooks(state);
+        state.queues.push_back(queue);
+        if (!state.running.is_set())
+        {
+            state.running.set();
+            state.interrupt_requested.clear();
+            Thread::Settings settings;
+            settings.priority = Thread::PRIORITY_LOW;
+            state.thread.start(_flush_thread_run, &state, settings);
+            JSB_LOG(Verbose, "async logger started");
+        }
+        return queue;
+    }
+
+    void AsyncLogger::release_queue(const std::shared_ptr<LogQueue>& p_queue)
+    {
+        if (!p_queue) return;
+
+        AsyncLoggerState& state = get_state();
+        {
+            InLoggerScope scope;
+            MutexLock lock(state.lock);
+            const auto it = std::find(state.queues.begin(), state.queues.end(), p_queue);
+            if (it != state.queues.end())
+            {
+                state.queues.erase(it);
+            }
+        }
+        // the flush thread may still hold a reference, drain it here anyway
+        p_queue->drain();
+    }
+
+    void AsyncLogger::notify()
+    {
+        AsyncLoggerState& state = get_state();
+        if (state.running.is_set())
+        {
+            state.semaphore.post();
+        }
+    }
+
+    void AsyncLogger::flush()
+    {
+        flush_all(get_state());
+    }
+
+    void AsyncLogger::flush_on_error()
+    {
+        // re-entered from an error printed by this thread while holding a logger lock
+        if (tl_in_logger) return;
+
+        InLoggerScope scope;
+        AsyncLoggerState& state = get_state();
+        std::vector<std::shared_ptr<LogQueue>> queues;
+        if (!state.lock.try_lock()) return;
+        queues = state.queues;
+        state.lock.unlock();
+        for (const std::shared_ptr<LogQueue>& queue : queues)
+        {
+            queue->try_drain();
+        }
+    }
+
+    void AsyncLogger::shutdown()
+    {
+        AsyncLoggerState& state = get_state();
+        {
+            InLoggerScope scope;
+            MutexLock lock(state.lock);
+            if (!state.running.is_set())
+            {
+                return;
+            }
+            state.running.clear();
+        }
+        state.interrupt_requested.set();
+        state.semaphore.post();
+        state.thread.wait_to_finish();
+
+        // flush the queues which are not released yet (the flush thread already did it, but it's cheap to double check)
+        flush_all(state);
+        JSB_LOG(Verbose, "async logger stopped");
+    }
+}
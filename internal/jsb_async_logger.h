@@ -0,0 +1,146 @@
+#ifndef GODOTJS_ASYNC_LOGGER_H
+#define GODOTJS_ASYNC_LOGGER_H
+
+#include <atomic>
+#include "jsb_internal_pch.h"
+#include "jsb_macros.h"
+#include "jsb_log_severity.h"
+#include "jsb_source_map.h"
+
+namespace jsb::internal
+{
+    struct SourceMapCache;
+
+    struct LogEntry
+    {
+        ELogSeverity::Type severity = ELogSeverity::Log;
+        String text;
+
+        // only used by Warning/Error (reported as the caller position)
+        SourcePosition position;
+
+        // raw stack frames captured from the runtime (not translated yet, see `resolve`)
+        Vector<SourcePosition> frames;
+
+        // append the frames to the text as a stacktrace (console.trace)
+        bool with_stacktrace = false;
+
+        // translate the raw frames with the source map, and take the top frame as `position`.
+        // it's deferred until the entry is actually emitted, the entries dropped by the queue never pay for it.
+        void resolve(SourceMapCache* p_source_map_cache);
+
+        // write to IConsoleOutput and the engine output (print_line/_err_print_error)
+        static void emit(const LogEntry& p_entry);
+    };
+
+    struct LogQueueStats
+    {
+        uint64_t pushed = 0;
+        uint64_t dropped = 0;
+        uint64_t rate_limited = 0;
+    };
+
+    // A bounded single-producer/single-consumer ring buffer of log entries owned by one Environment.
+    // The producer is always the thread of the Environment (console.* calls),
+    // the consumer is the flush thread of AsyncLogger or the producer itself on a synchronous drain.
+    // Entries are dropped (and counted) if the buffer is full, the producer never blocks on the flush thread.
+    class LogQueue
+    {
+    private:
+        struct RateWindow
+        {
+            uint64_t start_msec = 0;
+            uint32_t count = 0;
+        };
+
+        LogEntry* slots_;
+        uint32_t mask_;
+
+        // used by the consumer to resolve the entries (thread safe), it outlives the queue
+        SourceMapCache* source_map_cache_;
+
+        // max messages per second for each severity (0 for unlimited),
+        // limited separately, a flood of debug outputs never starves the warnings.
+        uint32_t rate_limits_[ELogSeverity::Fatal + 1] = {};
+        RateWindow rate_windows_[ELogSeverity::Fatal + 1];
+
+        // written by the producer only
+        std::atomic<uint32_t> head_ = 0;
+
+        // written by the consumer only
+        std::atomic<uint32_t> tail_ = 0;
+
+        // only one consumer at a time (flush thread or synchronous drain)
+        BinaryMutex consumer_lock_;
+
+        std::atomic<uint64_t> pushed_ = 0;
+        std::atomic<uint64_t> dropped_ = 0;
+        std::atomic<uint64_t> rate_limited_ = 0;
+
+        // number of dropped entries not reported yet (consumer only)
+        uint64_t reported_dropped_ = 0;
+
+    public:
+        // p_capacity is rounded up to the power of 2.
+        // p_rate_limit applies to the severities below Warning, see `set_rate_limit` for the others.
+        LogQueue(uint32_t p_capacity, uint32_t p_rate_limit, SourceMapCache* p_source_map_cache = nullptr);
+        ~LogQueue();
+
+        LogQueue(const LogQueue&) = delete;
+        LogQueue& operator=(const LogQueue&) = delete;
+
+        // [producer] change the max messages per second of a severity (0 for unlimited)
+        void set_rate_limit(ELogSeverity::Type p_severity, uint32_t p_rate_limit);
+
+        // [producer] return false if the entry is dropped (buffer full or rate limited)
+        bool push(LogEntry&& p_entry);
+
+        // [any thread] emit all pending entries in order, return the number of emitted entries
+        int drain();
+
+        // [any thread] drain only if no other consumer is running, return -1 if skipped.
+        // used on the error/crash paths, where waiting for the consumer may deadlock.
+        int try_drain();
+
+        // [producer] drain the pending entries and emit `p_entry` immediately after them.
+        // used for errors which must not be delayed (and keep ordering with the buffered ones).
+        void emit_sync(LogEntry& p_entry);
+
+        jsb_force_inline bool is_empty() const { return head_.load(std::memory_order_acquire) == tail_.load(std::memory_order_acquire); }
+
+        LogQueueStats get_stats() const;
+
+    private:
+        bool is_rate_limited(ELogSeverity::Type p_severity);
+        int drain_locked();
+    };
+
+    // Buffer console outputs from scripts, and write them on a dedicated thread,
+    // to avoid blocking the script threads on the slow engine output (stdout, editor log panel).
+    class AsyncLogger
+    {
+    public:
+        // create a queue for a new Environment, return nullptr if async logging is disabled in settings.
+        // `p_source_map_cache` (owned by the Environment) is used to resolve the entries on the flush thread.
+        static std::shared_ptr<LogQueue> create_queue(SourceMapCache* p_source_map_cache);
+
+        // flush all pending entries of the queue, and unregister it from the flush thread
+        static void release_queue(const std::shared_ptr<LogQueue>& p_queue);
+
+        // wake up the flush thread
+        static void notify();
+
+        // flush all queues synchronously
+        static void flush();
+
+        // flush all queues synchronously without blocking on any lock held by others (the queues being drained are skipped).
+        // it's called on engine errors, fatal errors, crashes (the crash handler prints through the engine loggers) and process exit,
+        // so that the buffered outputs before the failure are not lost.
+        static void flush_on_error();
+
+        // stop the flush thread after flushing all pending entries
+        static void shutdown();
+    };
+}
+
+#endif
@@ -0,0 +1,268 @@
+#include "jsb_call_profiler.h"
+#include "jsb_logger.h"
+
+namespace jsb::internal
+{
+    std::atomic<uint32_t> CallProfiler::users_ = 0;
+
+    namespace
+    {
+        // single-producer (the owner thread) and single-consumer (the main thread) ring buffer
+        struct ThreadBuffer
+        {
+            Thread::ID thread_id = Thread::UNASSIGNED_ID;
+            CallProfiler::Event* slots = nullptr;
+            uint32_t mask = 0;
+
+            std::atomic<uint32_t> head = 0;
+            std::atomic<uint32_t> tail = 0;
+
+            // the owner thread exited, the buffer will be deleted by the consumer after drained
+            std::atomic<bool> orphaned = false;
+
+            ThreadBuffer(Thread::ID p_thread_id, uint32_t p_capacity) : thread_id(p_thread_id)
+            {
+                const uint32_t capacity = next_power_of_2(p_capacity);
+                slots = memnew_arr(CallProfiler::Event, capacity);
+                mask = capacity - 1;
+            }
+
+            ~ThreadBuffer()
+            {
+                memdelete_arr(slots);
+            }
+        };
+
+        struct ThreadBufferHolder
+        {
+            ThreadBuffer* buffer = nullptr;
+
+            ~ThreadBufferHolder()
+            {
+                if (buffer) buffer->orphaned.store(true, std::memory_order_release);
+            }
+        };
+
+        struct CallProfilerState
+        {
+            // only for registering new thread buffers and collecting, never locked on recording
+            BinaryMutex lock;
+            std::vector<ThreadBuffer*> buffers;
+            std::atomic<uint64_t> dropped = 0;
+
+            // [main thread]
+            bool tracing = false;
+            uint64_t trace_begin_usec = 0;
+            std::vector<CallProfiler::Event> trace_events;
+        };
+
+        thread_local ThreadBufferHolder tls_buffer_;
+
+        // intentionally leaked, it may be accessed by the exiting threads after static destruction
+        CallProfilerState& get_state()
+        {
+            static CallProfilerState* state = new CallProfilerState();
+            return *state;
+        }
+
+        ThreadBuffer* get_thread_buffer()
+        {
+            if (jsb_likely(tls_buffer_.buffer)) return tls_buffer_.buffer;
+
+            ThreadBuffer* buffer = new ThreadBuffer(Thread::get_caller_id(), JSB_CALL_PROFILER_THREAD_BUFFER_SIZE);
+            CallProfilerState& state = get_state();
+            {
+                MutexLock lock(state.lock);
+                state.buffers.push_back(buffer);
+            }
+            tls_buffer_.buffer = buffer;
+            return buffer;
+        }
+
+        const char* get_kind_name(CallProfiler::Kind p_kind)
+        {
+            switch (p_kind)
+            {
+            case CallProfiler::ScriptCall: return "script";
+            case CallProfiler::NativeCall: return "native";
+            case CallProfiler::ModuleLoad: return "module";
+            default: return "unknown";
+            }
+        }
+
+        String json_string(const String& p_str)
+        {
+            return "\"" + p_str.json_escape() + "\"";
+        }
+    }
+
+    void CallProfiler::acquire()
+    {
+        users_.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void CallProfiler::release()
+    {
+        jsb_check(users_.load(std::memory_order_relaxed) != 0);
+        users_.fetch_sub(1, std::memory_order_relaxed);
+    }
+
+    void CallProfiler::record(Kind p_kind, const StringName& p_source, const StringName& p_class_name, const StringName& p_name, uint64_t p_begin_usec, uint64_t p_end_usec)
+    {
+        ThreadBuffer* buffer = get_thread_buffer();
+        const uint32_t head = buffer->head.load(std::memory_order_relaxed);
+        if (jsb_unlikely(head - buffer->tail.load(std::memory_order_acquire) > buffer->mask))
+        {
+            get_state().dropped.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+
+        Event& event = buffer->slots[head & buffer->mask];
+        event.kind = p_kind;
+        event.thread_id = buffer->thread_id;
+        event.begin_usec = p_begin_usec;
+        event.end_usec = p_end_usec;
+        event.source = p_source;
+        event.class_name = p_class_name;
+        event.name = p_name;
+        buffer->head.store(head + 1, std::memory_order_release);
+    }
+
+    void CallProfiler::collect(std::vector<Event>& r_events)
+    {
+        jsb_check(Thread::is_main_thread());
+        CallProfilerState& state = get_state();
+        MutexLock lock(state.lock);
+
+        for (auto it = state.buffers.begin(); it != state.buffers.end();)
+        {
+            ThreadBuffer* buffer = *it;
+
+            // check before draining, no more events will be written if the owner thread exited
+            const bool orphaned = buffer->orphaned.load(std::memory_order_acquire);
+            uint32_t tail = buffer->tail.load(std::memory_order_relaxed);
+            const uint32_t head = buffer->head.load(std::memory_order_acquire);
+            while (tail != head)
+            {
+                Event& event = buffer->slots[tail & buffer->mask];
+                if (state.tracing && event.begin_usec >= state.trace_begin_usec && state.trace_events.size() < JSB_CALL_PROFILER_MAX_TRACE_EVENTS)
+                {
+                    state.trace_events.push_back(event);
+                }
+                r_events.push_back(std::move(event));
+                ++tail;
+            }
+            buffer->tail.store(tail, std::memory_order_release);
+
+            if (orphaned)
+            {
+                delete buffer;
+                it = state.buffers.erase(it);
+                continue;
+            }
+            ++it;
+        }
+    }
+
+    uint64_t CallProfiler::get_dropped_num()
+    {
+        return get_state().dropped.load(std::memory_order_relaxed);
+    }
+
+    void CallProfiler::start_trace()
+    {
+        jsb_check(Thread::is_main_thread());
+        CallProfilerState& state = get_state();
+        if (state.tracing) return;
+
+        state.tracing = true;
+        state.trace_begin_usec = OS::get_singleton()->get_ticks_usec();
+        state.trace_events.clear();
+        acquire();
+        JSB_LOG(Verbose, "call profiler trace started");
+    }
+
+    void CallProfiler::stop_trace()
+    {
+        jsb_check(Thread::is_main_thread());
+        CallProfilerState& state = get_state();
+        if (!state.tracing) return;
+
+        // events not collected yet are discarded
+        state.tracing = false;
+        release();
+        JSB_LOG(Verbose, "call profiler trace stopped (%d events)", (int64_t) state.trace_events.size());
+    }
+
+    bool CallProfiler::is_tracing()
+    {
+        return get_state().tracing;
+    }
+
+    String CallProfiler::get_trace_json()
+    {
+        jsb_check(Thread::is_main_thread());
+        const CallProfilerState& state = get_state();
+        StringBuilder sb;
+        sb.append("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[");
+
+        HashSet<Thread::ID> threads;
+        bool first = true;
+        for (const Event& event : state.trace_events)
+        {
+            if (!threads.has(event.thread_id))
+            {
+                threads.insert(event.thread_id);
+                const String thread_name = event.thread_id == Thread::get_main_id() ? String("main") : jsb_format("thread %d", (uint64_t) event.thread_id);
+                sb.append(first ? "\n" : ",\n");
+                sb.append(jsb_format("{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":%d,\"args\":{\"name\":%s}}",
+                    (uint64_t) event.thread_id, json_string(thread_name)));
+                first = false;
+            }
+
+            const String name = event.class_name == StringName()
+                ? (event.name == StringName() ? (String) event.source : (String) event.name)
+                : (String) event.class_name + "." + (String) event.name;
+            // not using jsb_format here, it's too slow for a large number of events
+            sb.append(first ? "\n{\"name\":" : ",\n{\"name\":");
+            sb.append(json_string(name));
+            sb.append(",\"cat\":\"");
+            sb.append(get_kind_name(event.kind));
+            sb.append("\",\"ph\":\"X\",\"ts\":");
+            sb.append(itos((int64_t) (event.begin_usec - state.trace_begin_usec)));
+            sb.append(",\"dur\":");
+            sb.append(itos((int64_t) (event.end_usec - event.begin_usec)));
+            sb.append(",\"pid\":0,\"tid\":");
+            sb.append(itos((int64_t) event.thread_id));
+            if (event.source != StringName())
+            {
+                sb.append(",\"args\":{\"source\":");
+                sb.append(json_string(event.source));
+                sb.append("}");
+            }
+            sb.append("}");
+            first = false;
+        }
+        sb.append("\n]}\n");
+        return sb.as_string();
+    }
+
+    Error CallProfiler::save_trace(const String& p_path)
+    {
+        const Ref<FileAccess> file = FileAccess::open(p_path, FileAccess::WRITE);
+        if (file.is_null())
+        {
+            JSB_LOG(Error, "failed to write trace file %s", p_path);
+            return ERR_FILE_CANT_WRITE;
+        }
+        file->store_string(get_trace_json());
+        JSB_LOG(Log, "trace file saved %s", p_path);
+        return OK;
+    }
+
+    void CallProfiler::shutdown()
+    {
+        stop_trace();
+        get_state().trace_events.clear();
+    }
+}
@@ -0,0 +1,117 @@
+#ifndef GODOTJS_CALL_PROFILER_H
+#define GODOTJS_CALL_PROFILER_H
+
+#include <atomic>
+#include "jsb_internal_pch.h"
+#include "jsb_macros.h"
+
+#if JSB_WITH_CALL_PROFILER
+#   define JSB_CALL_PROFILER_SCOPE(Kind, Source, Class, Name) \
+    const ::jsb::internal::CallProfiler::Scope __CallProfilerScope(::jsb::internal::CallProfiler::Kind, Source, Class, Name)
+#else
+#   define JSB_CALL_PROFILER_SCOPE(Kind, Source, Class, Name) (void) 0
+#endif
+
+namespace jsb::internal
+{
+    // A low overhead profiler for the calls across the bridge.
+    // Events are written into lock-free per-thread buffers by the calling threads,
+    // and collected by the main thread (see `GodotJSScriptLanguage::frame`).
+    class CallProfiler
+    {
+    public:
+        enum Kind : uint8_t
+        {
+            // engine to JS (script instance method calls)
+            ScriptCall,
+            // JS to engine (godot object method calls)
+            NativeCall,
+            // loading a JS module (including the evaluation of the module body)
+            ModuleLoad,
+        };
+
+        struct Event
+        {
+            Kind kind = ScriptCall;
+            Thread::ID thread_id = Thread::UNASSIGNED_ID;
+            uint64_t begin_usec = 0;
+            uint64_t end_usec = 0;
+
+            // script path (ScriptCall), or module id (ModuleLoad)
+            StringName source;
+            StringName class_name;
+            StringName name;
+        };
+
+        // NOTE: only references are kept in Scope, use this instead of a temporary StringName
+        jsb_force_inline static const StringName& empty_name()
+        {
+            static const StringName name;
+            return name;
+        }
+
+        struct Scope
+        {
+            const Kind kind;
+            const StringName& source;
+            const StringName& class_name;
+            const StringName& name;
+            uint64_t begin_usec = 0;
+
+            jsb_force_inline Scope(Kind p_kind, const StringName& p_source, const StringName& p_class_name, const StringName& p_name)
+                : kind(p_kind), source(p_source), class_name(p_class_name), name(p_name), begin_usec(begin())
+            {
+            }
+
+            jsb_force_inline ~Scope()
+            {
+                if (jsb_unlikely(begin_usec != 0))
+                {
+                    end(kind, source, class_name, name, begin_usec);
+                }
+            }
+        };
+
+        jsb_force_inline static bool is_enabled() { return users_.load(std::memory_order_relaxed) != 0; }
+
+        // return the begin time of a call, or zero if not enabled
+        jsb_force_inline static uint64_t begin() { return jsb_unlikely(is_enabled()) ? OS::get_singleton()->get_ticks_usec() : 0; }
+
+        // record a call started with `begin()` (only if p_begin_usec is not zero)
+        static void end(Kind p_kind, const StringName& p_source, const StringName& p_class_name, const StringName& p_name, uint64_t p_begin_usec)
+        {
+            record(p_kind, p_source, p_class_name, p_name, p_begin_usec, OS::get_singleton()->get_ticks_usec());
+        }
+
+        // recording is enabled as long as there is any user (the engine profiler or a trace session)
+        static void acquire();
+        static void release();
+
+        // [any thread] append an event to the buffer of the calling thread
+        static void record(Kind p_kind, const StringName& p_source, const StringName& p_class_name, const StringName& p_name, uint64_t p_begin_usec, uint64_t p_end_usec);
+
+        // [main thread] move all recorded events from the per-thread buffers into `r_events` (appended, in order per thread),
+        // events are also kept for the trace export if a trace session is running.
+        static void collect(std::vector<Event>& r_events);
+
+        // total num of events dropped since the process started
+        static uint64_t get_dropped_num();
+
+        // [main thread] trace session for exporting
+        static void start_trace();
+        static void stop_trace();
+        static bool is_tracing();
+
+        // [main thread] export the events (collected so far) in the last (or current) trace session in Chrome Trace Event Format
+        // (could be opened with chrome://tracing, Perfetto or Speedscope)
+        static String get_trace_json();
+        static Error save_trace(const String& p_path);
+
+        static void shutdown();
+
+    private:
+        static std::atomic<uint32_t> users_;
+    };
+}
+
+#endif
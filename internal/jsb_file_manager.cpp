@@ -1,62 +1,323 @@
-﻿// #include "jsb_file_manager.h"
-//
-// namespace jsb::internal
-// {
-//     FileManager* FileManager::singleton_ = nullptr;
-//
-//     FileManager::FileManager()
-//     {
-//         jsb_check(!singleton_);
-//         singleton_ = this;
-//     }
-//
-//     FileManager::~FileManager()
-//     {
-//         jsb_check(singleton_);
-//         singleton_ = nullptr;
-//     }
-//
-//     FileManager::FileHandle FileManager::load_async(const String &p_path)
-//     {
-//         //TODO
-//         return {};
-//     }
-//
-//     FileManager::FileHandle FileManager::load_sync(const String &p_path)
-//     {
-//         mutex_.lock();
-//         mutex_.unlock();
-//         //TODO
-//         return {};
-//     }
-//
-//     void FileManager::run()
-//     {
-//         mutex_.lock();
-//
-//         mutex_.unlock();
-//     }
-//
-//     void FileManager::retain_file(Index32 p_id)
-//     {
-//
-//     }
-//
-//     void FileManager::release_file(Index32 p_id)
-//     {
-//
-//     }
-//
-//     FileManager::FileHandle::FileHandle()
-//     {
-//     }
-//
-//     FileManager::FileHandle::~FileHandle()
-//     {
-//         // if (FileManager* fm = singleton_)
-//         // {
-//         //     fm->release_file(id_);
-//         // }
-//     }
-//
-// }
+#include "jsb_file_manager.h"
+#include "jsb_thread_util.h"
+#include "jsb_logger.h"
+
+#include "core/os/semaphore.h"
+#include "core/crypto/crypto_core.h"
+
+namespace jsb::internal
+{
+    namespace
+    {
+        struct FileEntry
+        {
+            FileContent content;
+            uint64_t last_access = 0;
+            bool pending = false;
+            bool failed = false;
+        };
+
+        struct FileManagerState
+        {
+            BinaryMutex lock;
+            HashMap<String, FileEntry> entries;
+            std::vector<String> queue;
+            uint64_t bytes = 0;
+            uint64_t tick = 0;
+
+            uint64_t hits = 0;
+            uint64_t misses = 0;
+            uint64_t prefetched = 0;
+            uint64_t evicted = 0;
+
+            Thread threads[JSB_FILE_IO_THREADS];
+            Semaphore semaphore;
+            SafeFlag running = SafeFlag(false);
+            SafeFlag interrupt_requested = SafeFlag(false);
+        };
+
+        FileManagerState& get_state()
+        {
+            static FileManagerState state;
+            return state;
+        }
+
+        bool read_file(const String& p_path, FileContent& r_content)
+        {
+            const Ref<FileAccess> file = FileAccess::open(p_path, FileAccess::READ);
+            if (file.is_null())
+            {
+                return false;
+            }
+            const uint64_t len = file->get_length();
+            if (len == 0)
+            {
+                return false;
+            }
+            r_content.bytes.resize((int) len + 1);
+            r_content.bytes.write[(int) len] = 0;
+            if (file->get_buffer(r_content.bytes.ptrw(), len) != len)
+            {
+                return false;
+            }
+            r_content.path_absolute = file->get_path_absolute();
+#if JSB_SUPPORT_RELOAD && defined(TOOLS_ENABLED)
+            r_content.time_modified = FileAccess::get_modified_time(p_path);
+#endif
+            return true;
+        }
+
+        // evict the least recently used files until the budget is satisfied (the file `p_keep` is never evicted)
+        void evict_locked(FileManagerState& p_state, const String& p_keep)
+        {
+            while (p_state.bytes > JSB_FILE_CACHE_BUDGET)
+            {
+                const KeyValue<String, FileEntry>* lru = nullptr;
+                for (const KeyValue<String, FileEntry>& kv : p_state.entries)
+                {
+                    if (kv.value.pending || kv.value.failed || kv.key == p_keep) continue;
+                    if (!lru || kv.value.last_access < lru->value.last_access) lru = &kv;
+                }
+                if (!lru)
+                {
+                    break;
+                }
+                p_state.bytes -= lru->value.content.bytes.size();
+                ++p_state.evicted;
+                p_state.entries.erase(lru->key);
+            }
+        }
+
+        // store the content read (or failed to read) into the cache
+        void store_locked(FileManagerState& p_state, const String& p_path, const FileContent* p_content)
+        {
+            FileEntry* entry = p_state.entries.getptr(p_path);
+            if (!entry)
+            {
+                entry = &p_state.entries.insert(p_path, FileEntry())->value;
+            }
+            else if (!entry->pending && !entry->failed)
+            {
+                p_state.bytes -= entry->content.bytes.size();
+            }
+            entry->pending = false;
+            entry->failed = !p_content;
+            entry->last_access = ++p_state.tick;
+            if (!p_content)
+            {
+                entry->content = {};
+                return;
+            }
+            entry->content = *p_content;
+            p_state.bytes += p_content->bytes.size();
+            evict_locked(p_state, p_path);
+
+            // too large to keep
+            if (p_state.bytes > JSB_FILE_CACHE_BUDGET)
+            {
+                p_state.bytes -= p_content->bytes.size();
+                p_state.entries.erase(p_path);
+            }
+        }
+
+        void _io_thread_run(void* p_data)
+        {
+            FileManagerState& state = *(FileManagerState*) p_data;
+            ThreadUtil::set_name("JSFileIO");
+            while (true)
+            {
+                state.semaphore.wait();
+                if (state.interrupt_requested.is_set())
+                {
+                    break;
+                }
+
+                String path;
+                {
+                    MutexLock lock(state.lock);
+                    if (state.queue.empty())
+                    {
+                        continue;
+                    }
+                    path = state.queue.back();
+                    state.queue.pop_back();
+                }
+
+                FileContent content;
+                const bool succeeded = read_file(path, content);
+                MutexLock lock(state.lock);
+
+                // dropped by `clear`
+                if (const FileEntry* entry = state.entries.getptr(path); !entry || !entry->pending)
+                {
+                    continue;
+                }
+                store_locked(state, path, succeeded ? &content : nullptr);
+            }
+        }
+    }
+
+    uint64_t FileContentSourceReader::get_buffer(uint8_t* p_dst, uint64_t p_length) const
+    {
+        const uint64_t len = MIN(p_length, content_.get_length());
+        memcpy(p_dst, content_.bytes.ptr(), len);
+        return len;
+    }
+
+    String FileContentSourceReader::get_hash() const
+    {
+#if JSB_SUPPORT_RELOAD && defined(TOOLS_ENABLED)
+        // same as `FileAccess::get_md5`
+        unsigned char md5[16];
+        CryptoCore::md5(content_.bytes.ptr(), (int) content_.get_length(), md5);
+        return String::md5(md5);
+#else
+        return String();
+#endif
+    }
+
+    void FileManager::prefetch(const String& p_path)
+    {
+        FileManagerState& state = internal::get_state();
+        {
+            MutexLock lock(state.lock);
+            if (const FileEntry* entry = state.entries.getptr(p_path); entry && !entry->failed)
+            {
+                return;
+            }
+
+            FileEntry entry;
+            entry.pending = true;
+            state.entries[p_path] = entry;
+            state.queue.push_back(p_path);
+            ++state.prefetched;
+
+            if (!state.running.is_set())
+            {
+                state.running.set();
+                state.interrupt_requested.clear();
+                Thread::Settings settings;
+                settings.priority = Thread::PRIORITY_LOW;
+                for (Thread& thread : state.threads)
+                {
+                    thread.start(_io_thread_run, &state, settings);
+                }
+                JSB_LOG(Verbose, "file manager started");
+            }
+        }
+        state.semaphore.post();
+    }
+
+    FileManager::FileState FileManager::get_state(const String& p_path)
+    {
+        FileManagerState& state = internal::get_state();
+        MutexLock lock(state.lock);
+        const FileEntry* entry = state.entries.getptr(p_path);
+        if (!entry) return FileState::None;
+        if (entry->pending) return FileState::Pending;
+        return entry->failed ? FileState::Failed : FileState::Cached;
+    }
+
+    bool FileManager::read(const String& p_path, FileContent& r_content)
+    {
+        FileManagerState& state = internal::get_state();
+        {
+            MutexLock lock(state.lock);
+            if (FileEntry* entry = state.entries.getptr(p_path); entry && !entry->pending && !entry->failed)
+            {
+                entry->last_access = ++state.tick;
+                r_content = entry->content;
+            }
+        }
+
+#if JSB_SUPPORT_RELOAD && defined(TOOLS_ENABLED)
+        // the file may be changed on disk (compiled again by tsc)
+        if (!r_content.is_empty() && r_content.time_modified != FileAccess::get_modified_time(p_path))
+        {
+            r_content = {};
+        }
+#endif
+        if (!r_content.is_empty())
+        {
+            MutexLock lock(state.lock);
+            ++state.hits;
+            return true;
+        }
+
+        // read it synchronously even if it's being read on the I/O threads
+        const bool succeeded = read_file(p_path, r_content);
+        if (!succeeded)
+        {
+            r_content = {};
+        }
+        MutexLock lock(state.lock);
+        ++state.misses;
+        store_locked(state, p_path, succeeded ? &r_content : nullptr);
+        return succeeded;
+    }
+
+    FileManager::Stats FileManager::get_stats()
+    {
+        FileManagerState& state = internal::get_state();
+        MutexLock lock(state.lock);
+        Stats stats;
+        for (const KeyValue<String, FileEntry>& kv : state.entries)
+        {
+            if (kv.value.pending) ++stats.pending;
+            else if (!kv.value.failed) ++stats.files;
+        }
+        stats.bytes = state.bytes;
+        stats.hits = state.hits;
+        stats.misses = state.misses;
+        stats.prefetched = state.prefetched;
+        stats.evicted = state.evicted;
+        return stats;
+    }
+
+    void FileManager::clear()
+    {
+        FileManagerState& state = internal::get_state();
+        MutexLock lock(state.lock);
+
+        // keep the pending ones, they're still in the queue
+        Vector<String> dropped;
+        for (const KeyValue<String, FileEntry>& kv : state.entries)
+        {
+            if (!kv.value.pending) dropped.push_back(kv.key);
+        }
+        for (const String& path : dropped)
+        {
+            state.entries.erase(path);
+        }
+        state.bytes = 0;
+    }
+
+    void FileManager::shutdown()
+    {
+        FileManagerState& state = internal::get_state();
+        {
+            MutexLock lock(state.lock);
+            if (state.running.is_set())
+            {
+                state.running.clear();
+                state.interrupt_requested.set();
+            }
+            else
+            {
+                state.interrupt_requested.clear();
+            }
+        }
+        if (state.interrupt_requested.is_set())
+        {
+            for (int index = 0; index < JSB_FILE_IO_THREADS; ++index) state.semaphore.post();
+            for (Thread& thread : state.threads) thread.wait_to_finish();
+            state.interrupt_requested.clear();
+            JSB_LOG(Verbose, "file manager stopped");
+        }
+
+        MutexLock lock(state.lock);
+        state.entries.clear();
+        state.queue.clear();
+        state.bytes = 0;
+    }
+}
@@ -1,66 +1,88 @@
-﻿// #ifndef GODOTJS_FILE_MANAGER_H
-// #define GODOTJS_FILE_MANAGER_H
-//
-// #include "jsb_sarray.h"
-// #include "jsb_sindex.h"
-//
-// namespace jsb::internal
-// {
-//     class FileCallback
-//     {
-//         virtual ~FileCallback() {}
-//
-//         virtual void finish() = 0;
-//     };
-//
-//     class FileManager
-//     {
-//     private:
-//         struct Buffer
-//         {
-//             String file_path_;
-//
-//             size_t size = 0;
-//             uint8_t* ptr = nullptr;
-//             uint32_t ref_count_ = 0;
-//         };
-//
-//         // SArray<Task> pending_;
-//         // SArray<Task> done_;
-//
-//         BinaryMutex mutex_;
-//         static FileManager* singleton_;
-//
-//     public:
-//         struct FileHandle
-//         {
-//         private:
-//             Index32 id_;
-//             FileHandle();
-//             ~FileHandle();
-//
-//         public:
-//             // bool is_null() const;
-//             // bool is_loaded() const;
-//             // String get_path_absolute() const;
-//             // uint64_t get_buffer(uint8_t *p_dst, uint64_t p_length) const;
-//         };
-//
-//         static FileManager* get_singleton() { return singleton_; }
-//
-//         FileManager();
-//         ~FileManager();
-//
-//         FileHandle load_async(const String& p_path);
-//         FileHandle load_sync(const String& p_path);
-//
-//         void run();
-//
-//     private:
-//         void retain_file(Index32 p_id);
-//         void release_file(Index32 p_id);
-//     };
-//
-// }
-//
-// #endif
+#ifndef GODOTJS_FILE_MANAGER_H
+#define GODOTJS_FILE_MANAGER_H
+
+#include "jsb_internal_pch.h"
+#include "jsb_macros.h"
+#include "jsb_source_reader.h"
+
+namespace jsb::internal
+{
+    // the content of a file read by FileManager (copy-on-write, cheap to copy)
+    struct FileContent
+    {
+        // zero-terminated (the terminator is not counted in `get_length`)
+        Vector<uint8_t> bytes;
+        String path_absolute;
+        uint64_t time_modified = 0;
+
+        jsb_force_inline bool is_empty() const { return bytes.size() <= 1; }
+        jsb_force_inline uint64_t get_length() const { return bytes.is_empty() ? 0 : (uint64_t) bytes.size() - 1; }
+    };
+
+    class FileContentSourceReader : public ISourceReader
+    {
+    private:
+        FileContent content_;
+
+    public:
+        FileContentSourceReader(const FileContent& p_content) : content_(p_content) {}
+        virtual ~FileContentSourceReader() override = default;
+
+        virtual bool is_null() const override { return content_.bytes.is_empty(); }
+        virtual String get_path_absolute() const override { return content_.path_absolute; }
+        virtual uint64_t get_length() const override { return content_.get_length(); }
+        virtual uint64_t get_buffer(uint8_t *p_dst, uint64_t p_length) const override;
+
+        virtual uint64_t get_time_modified() const override { return content_.time_modified; }
+        virtual String get_hash() const override;
+    };
+
+    // Process-wide reader of the script sources, with a bounded pool of I/O threads and a byte-budgeted content cache.
+    // The sources could be prefetched in background ahead of demand (e.g. the scripts of an upcoming scene),
+    // then `read` of them is a memory lookup. The least recently used files are evicted if the budget is exceeded.
+    class FileManager
+    {
+    public:
+        enum class FileState : uint8_t
+        {
+            // neither cached nor being read
+            None,
+            // queued or being read on the I/O threads
+            Pending,
+            Cached,
+            // not readable
+            Failed,
+        };
+
+        struct Stats
+        {
+            int files = 0;
+            uint64_t bytes = 0;
+            uint32_t pending = 0;
+
+            uint64_t hits = 0;
+            uint64_t misses = 0;
+            uint64_t prefetched = 0;
+            uint64_t evicted = 0;
+        };
+
+        // [thread safe] queue a file to read on the I/O threads if it's neither cached nor being read
+        static void prefetch(const String& p_path);
+
+        // [thread safe]
+        static FileState get_state(const String& p_path);
+
+        // [thread safe] get the content from the cache, or read it synchronously (and cache it)
+        static bool read(const String& p_path, FileContent& r_content);
+
+        static Stats get_stats();
+
+        // drop all cached files (the pending reads are not affected)
+        static void clear();
+
+        // stop the I/O threads, and drop all cached files and pending reads
+        static void shutdown();
+    };
+}
+
+#endif
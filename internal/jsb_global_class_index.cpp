@@ -0,0 +1,525 @@
+#include "jsb_global_class_index.h"
+#include "jsb_path_util.h"
+#include "jsb_logger.h"
+
+namespace jsb::internal
+{
+    namespace
+    {
+        // 'JSCI'
+        constexpr uint32_t kIndexFileMagic = 0x4943534a;
+        // increase it if the file layout or the parsing rules changed
+        constexpr uint32_t kIndexFileVersion = 2;
+
+        // seconds, covers the 1 second resolution of the modified time and the clock skew between the file system and the process
+        constexpr uint64_t kRacyWindow = 2;
+
+        struct Token
+        {
+            enum Kind : uint8_t
+            {
+                End,
+                Identifier,
+                Number,
+                // string literal (begin/end excludes the quotes)
+                String,
+                Regex,
+                Punct,
+            };
+
+            Kind kind = End;
+            int begin = 0;
+            int end = 0;
+        };
+
+        // a tokenizer only good enough for finding the declarations at the top level of TS/JS source files
+        class Tokenizer
+        {
+            const ::String* source_;
+            const char32_t* ptr_;
+            int len_;
+            int pos_ = 0;
+            Token last_;
+
+        public:
+            Tokenizer(const ::String& p_source) : source_(&p_source), ptr_(p_source.ptr()), len_(p_source.length()) {}
+
+            jsb_force_inline static bool is_identifier_char(char32_t c)
+            {
+                return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || c == '_' || c == '$' || c > 127;
+            }
+
+            Token next()
+            {
+                while (pos_ < len_)
+                {
+                    const char32_t c = ptr_[pos_];
+                    if (c <= ' ') { ++pos_; continue; }
+
+                    const char32_t n = pos_ + 1 < len_ ? ptr_[pos_ + 1] : 0;
+                    if (c == '/' && n == '/')
+                    {
+                        while (pos_ < len_ && ptr_[pos_] != '\n') ++pos_;
+                        continue;
+                    }
+                    if (c == '/' && n == '*')
+                    {
+                        pos_ += 2;
+                        while (pos_ < len_ && !(ptr_[pos_] == '*' && pos_ + 1 < len_ && ptr_[pos_ + 1] == '/')) ++pos_;
+                        pos_ += 2;
+                        continue;
+                    }
+
+                    Token token;
+                    token.begin = pos_;
+                    if (c == '"' || c == '\'' || c == '`')
+                    {
+                        // NOTE: nested template literals in `${}` are not supported
+                        ++pos_;
+                        while (pos_ < len_ && ptr_[pos_] != c)
+                        {
+                            pos_ += ptr_[pos_] == '\\' ? 2 : 1;
+                        }
+                        token.kind = Token::String;
+                        token.begin += 1;
+                        token.end = MIN(pos_, len_);
+                        ++pos_;
+                    }
+                    else if (is_identifier_char(c))
+                    {
+                        const bool is_number = c >= '0' && c <= '9';
+                        while (pos_ < len_ && (is_identifier_char(ptr_[pos_]) || (is_number && ptr_[pos_] == '.'))) ++pos_;
+                        token.kind = is_number ? Token::Number : Token::Identifier;
+                        token.end = pos_;
+                    }
+                    else if (c == '/' && is_regex_allowed())
+                    {
+                        bool in_class = false;
+                        ++pos_;
+                        while (pos_ < len_ && ptr_[pos_] != '\n')
+                        {
+                            const char32_t rc = ptr_[pos_];
+                            if (rc == '\\') { pos_ += 2; continue; }
+                            ++pos_;
+                            if (rc == '[') in_class = true;
+                            else if (rc == ']') in_class = false;
+                            else if (rc == '/' && !in_class) break;
+                        }
+                        // flags
+                        while (pos_ < len_ && is_identifier_char(ptr_[pos_])) ++pos_;
+                        token.kind = Token::Regex;
+                        token.end = pos_;
+                    }
+                    else
+                    {
+                        token.kind = Token::Punct;
+                        token.end = ++pos_;
+                    }
+                    last_ = token;
+                    return token;
+                }
+                last_ = Token();
+                return last_;
+            }
+
+            // read the next token only if it's the expected identifier
+            bool accept(const char* p_identifier)
+            {
+                Tokenizer saved = *this;
+                if (const Token token = next(); token.kind == Token::Identifier && equals(token, p_identifier)) return true;
+                *this = saved;
+                return false;
+            }
+
+            // read the next token only if it's the expected punctuator
+            bool accept(char32_t p_punct)
+            {
+                Tokenizer saved = *this;
+                if (const Token token = next(); token.kind == Token::Punct && ptr_[token.begin] == p_punct) return true;
+                *this = saved;
+                return false;
+            }
+
+            // read the next token only if it's an identifier
+            bool accept_identifier(::String& r_name)
+            {
+                Tokenizer saved = *this;
+                if (const Token token = next(); token.kind == Token::Identifier)
+                {
+                    r_name = text(token);
+                    return true;
+                }
+                *this = saved;
+                return false;
+            }
+
+            bool accept_string(::String& r_str)
+            {
+                Tokenizer saved = *this;
+                if (const Token token = next(); token.kind == Token::String)
+                {
+                    r_str = text(token);
+                    return true;
+                }
+                *this = saved;
+                return false;
+            }
+
+            // read a (dotted) name like `godot.Node` and return the last part (`Node`)
+            bool accept_qualified_name(::String& r_name)
+            {
+                if (!accept_identifier(r_name)) return false;
+                while (true)
+                {
+                    Tokenizer saved = *this;
+                    if (!accept('.') || !accept_identifier(r_name))
+                    {
+                        *this = saved;
+                        return true;
+                    }
+                }
+            }
+
+            // skip tokens until the expected identifier (stop at the class body or the end of the statement)
+            bool skip_until(const char* p_identifier)
+            {
+                while (true)
+                {
+                    if (accept(p_identifier)) return true;
+                    Tokenizer saved = *this;
+                    const Token token = next();
+                    if (token.kind == Token::End) return false;
+                    if (token.kind == Token::Punct && (ptr_[token.begin] == '{' || ptr_[token.begin] == ';'))
+                    {
+                        *this = saved;
+                        return false;
+                    }
+                }
+            }
+
+            bool is_punct(const Token& p_token, char32_t p_punct) const
+            {
+                return p_token.kind == Token::Punct && ptr_[p_token.begin] == p_punct;
+            }
+
+            bool equals(const Token& p_token, const char* p_str) const
+            {
+                int i = p_token.begin;
+                for (; *p_str; ++p_str, ++i)
+                {
+                    if (i >= p_token.end || ptr_[i] != (char32_t) *p_str) return false;
+                }
+                return i == p_token.end;
+            }
+
+            ::String text(const Token& p_token) const
+            {
+                return source_->substr(p_token.begin, p_token.end - p_token.begin);
+            }
+
+        private:
+            bool is_regex_allowed() const
+            {
+                switch (last_.kind)
+                {
+                case Token::Number:
+                case Token::String:
+                case Token::Regex:
+                    return false;
+                case Token::Identifier:
+                    // keywords which could be followed by an expression
+                    return equals(last_, "return") || equals(last_, "typeof") || equals(last_, "case") || equals(last_, "in")
+                        || equals(last_, "of") || equals(last_, "new") || equals(last_, "delete") || equals(last_, "void")
+                        || equals(last_, "throw") || equals(last_, "yield") || equals(last_, "await") || equals(last_, "else");
+                case Token::Punct:
+                    return ptr_[last_.begin] != ')' && ptr_[last_.begin] != ']' && ptr_[last_.begin] != '}';
+                default:
+                    return true;
+                }
+            }
+        };
+
+        bool parse_typescript(const String& p_source, GlobalClassInfo& r_info)
+        {
+            Tokenizer tokenizer(p_source);
+            int depth = 0;
+            int parens = 0;
+            bool is_tool = false;
+            String icon_path;
+
+            while (true)
+            {
+                const Token token = tokenizer.next();
+                if (token.kind == Token::End) return false;
+                if (tokenizer.is_punct(token, '(')) { ++parens; continue; }
+                if (tokenizer.is_punct(token, ')')) { if (parens > 0) --parens; continue; }
+                if (tokenizer.is_punct(token, '{')) { ++depth; continue; }
+                if (tokenizer.is_punct(token, '}'))
+                {
+                    // decorators are only applicable to the next declaration (object literals in the decorator arguments are not counted)
+                    if (depth > 0 && --depth == 0 && parens == 0) { is_tool = false; icon_path = String(); }
+                    continue;
+                }
+                if (depth != 0) continue;
+                if (tokenizer.is_punct(token, ';')) { is_tool = false; icon_path = String(); continue; }
+
+                // decorators: `@tool()` and `@icon("path")`
+                if (tokenizer.is_punct(token, '@'))
+                {
+                    if (tokenizer.accept("tool")) is_tool = true;
+                    else if (tokenizer.accept("icon") && tokenizer.accept('(')) tokenizer.accept_string(icon_path);
+                    continue;
+                }
+
+                // `export default class ClassName extends BaseClassName`
+                String class_name;
+                String base_type;
+                if (token.kind == Token::Identifier && tokenizer.equals(token, "export")
+                    && tokenizer.accept("default") && tokenizer.accept("class") && tokenizer.accept_identifier(class_name)
+                    && tokenizer.skip_until("extends") && tokenizer.accept_qualified_name(base_type))
+                {
+                    r_info.class_name = class_name;
+                    r_info.base_type = base_type;
+                    r_info.icon_path = icon_path;
+                    r_info.is_tool = is_tool;
+                    return true;
+                }
+            }
+        }
+
+        bool parse_javascript(const String& p_source, GlobalClassInfo& r_info)
+        {
+            Tokenizer tokenizer(p_source);
+            HashMap<String, String> classes;
+            String default_name;
+
+            while (true)
+            {
+                const Token token = tokenizer.next();
+                if (token.kind == Token::End) break;
+                if (token.kind != Token::Identifier) continue;
+
+                // 'class ClassName extends BaseClassName'
+                if (tokenizer.equals(token, "class"))
+                {
+                    String class_name;
+                    String base_type;
+                    if (tokenizer.accept_identifier(class_name) && tokenizer.skip_until("extends") && tokenizer.accept_qualified_name(base_type))
+                    {
+                        classes[class_name] = base_type;
+                    }
+                    continue;
+                }
+
+                // 'exports.default = ClassName' or 'exports.default = class ClassName extends BaseClassName'
+                if (tokenizer.equals(token, "exports") && tokenizer.accept('.') && tokenizer.accept("default") && tokenizer.accept('='))
+                {
+                    String class_name;
+                    String base_type;
+                    if (tokenizer.accept("class"))
+                    {
+                        if (tokenizer.accept_identifier(class_name) && tokenizer.skip_until("extends") && tokenizer.accept_qualified_name(base_type))
+                        {
+                            r_info.class_name = class_name;
+                            r_info.base_type = base_type;
+                            return true;
+                        }
+                        continue;
+                    }
+                    // the last assignment wins (tsc emits `exports.default = void 0;` at the beginning)
+                    if (tokenizer.accept_identifier(class_name) && class_name != "void")
+                    {
+                        default_name = class_name;
+                    }
+                }
+            }
+
+            if (const String* base_type = classes.getptr(default_name))
+            {
+                r_info.class_name = default_name;
+                r_info.base_type = *base_type;
+                return true;
+            }
+            return false;
+        }
+    }
+
+    bool GlobalClassIndex::parse(const String& p_source, bool p_is_javascript, GlobalClassInfo& r_info)
+    {
+        return p_is_javascript ? parse_javascript(p_source, r_info) : parse_typescript(p_source, r_info);
+    }
+
+    bool GlobalClassIndex::is_racy(const Entry& p_entry)
+    {
+        return p_entry.time_modified + kRacyWindow >= p_entry.time_scanned;
+    }
+
+    bool GlobalClassIndex::get(const String& p_path, GlobalClassInfo& r_info)
+    {
+        const uint64_t time_modified = FileAccess::get_modified_time(p_path);
+        {
+            MutexLock lock(lock_);
+            if (const Entry* entry = entries_.getptr(p_path); entry && time_modified != 0 && entry->time_modified == time_modified && !is_racy(*entry))
+            {
+                ++stat_hits_;
+                r_info = entry->info;
+                return true;
+            }
+        }
+
+        // taken before reading, a modification after it is always treated as racy
+        const uint64_t time_scanned = (uint64_t) OS::get_singleton()->get_unix_time();
+        Error err;
+        const Ref<FileAccess> file_access = FileAccess::open(p_path, FileAccess::READ, &err);
+        if (err != OK)
+        {
+            return false;
+        }
+        const String source = file_access->get_as_utf8_string();
+        const String hash = source.md5_text();
+        {
+            MutexLock lock(lock_);
+            if (Entry* entry = entries_.getptr(p_path); entry && entry->hash == hash)
+            {
+                ++hash_hits_;
+                entry->time_modified = time_modified;
+                entry->time_scanned = time_scanned;
+                dirty_ = true;
+                r_info = entry->info;
+                return true;
+            }
+        }
+
+        GlobalClassInfo info;
+        parse(source, PathUtil::is_recognized_javascript_extension(p_path), info);
+        {
+            MutexLock lock(lock_);
+            ++parsed_;
+            entries_[p_path] = { time_modified, time_scanned, hash, info };
+            dirty_ = true;
+        }
+        r_info = info;
+        return true;
+    }
+
+    Error GlobalClassIndex::load(const String& p_index_path)
+    {
+        Error err;
+        const Ref<FileAccess> file = FileAccess::open(p_index_path, FileAccess::READ, &err);
+        if (err != OK)
+        {
+            return err;
+        }
+        if (file->get_32() != kIndexFileMagic || file->get_32() != kIndexFileVersion)
+        {
+            JSB_LOG(Verbose, "ignore outdated global class index %s", p_index_path);
+            return ERR_FILE_UNRECOGNIZED;
+        }
+
+        const uint32_t num = file->get_32();
+        HashMap<String, Entry> entries;
+        entries.reserve(num);
+        for (uint32_t i = 0; i < num; ++i)
+        {
+            const String path = file->get_pascal_string();
+            Entry entry;
+            entry.time_modified = file->get_64();
+            entry.time_scanned = file->get_64();
+            entry.hash = file->get_pascal_string();
+            entry.info.class_name = file->get_pascal_string();
+            entry.info.base_type = file->get_pascal_string();
+            entry.info.icon_path = file->get_pascal_string();
+            entry.info.is_tool = file->get_8() != 0;
+            if (file->eof_reached())
+            {
+                JSB_LOG(Warning, "corrupted global class index %s", p_index_path);
+                return ERR_FILE_CORRUPT;
+            }
+            entries.insert(path, entry);
+        }
+
+        MutexLock lock(lock_);
+        for (KeyValue<String, Entry>& kv : entries)
+        {
+            if (!entries_.has(kv.key)) entries_.insert(kv.key, std::move(kv.value));
+        }
+        JSB_LOG(Verbose, "global class index loaded %s (%d entries)", p_index_path, num);
+        return OK;
+    }
+
+    Error GlobalClassIndex::save(const String& p_index_path)
+    {
+        // copy to avoid blocking the scanning threads while writing
+        HashMap<String, Entry> entries;
+        {
+            MutexLock lock(lock_);
+            if (!dirty_) return OK;
+            entries = entries_;
+            dirty_ = false;
+        }
+
+        // the index is not notified when a file is deleted, drop them here (not on every scan, since it costs a stat for each entry)
+        Vector<String> deleted;
+        for (const KeyValue<String, Entry>& kv : entries)
+        {
+            if (!FileAccess::exists(kv.key)) deleted.push_back(kv.key);
+        }
+        if (!deleted.is_empty())
+        {
+            MutexLock lock(lock_);
+            for (const String& path : deleted)
+            {
+                entries.erase(path);
+                entries_.erase(path);
+            }
+            JSB_LOG(Verbose, "global class index: %d entries of deleted files dropped", deleted.size());
+        }
+
+        Error err;
+        const Ref<FileAccess> file = FileAccess::open(p_index_path, FileAccess::WRITE, &err);
+        if (err != OK)
+        {
+            JSB_LOG(Warning, "failed to write global class index %s", p_index_path);
+            return err;
+        }
+        file->store_32(kIndexFileMagic);
+        file->store_32(kIndexFileVersion);
+        file->store_32((uint32_t) entries.size());
+        for (const KeyValue<String, Entry>& kv : entries)
+        {
+            file->store_pascal_string(kv.key);
+            file->store_64(kv.value.time_modified);
+            file->store_64(kv.value.time_scanned);
+            file->store_pascal_string(kv.value.hash);
+            file->store_pascal_string(kv.value.info.class_name);
+            file->store_pascal_string(kv.value.info.base_type);
+            file->store_pascal_string(kv.value.info.icon_path);
+            file->store_8(kv.value.info.is_tool ? 1 : 0);
+        }
+        return OK;
+    }
+
+    bool GlobalClassIndex::is_dirty() const
+    {
+        MutexLock lock(lock_);
+        return dirty_;
+    }
+
+    GlobalClassIndex::Stats GlobalClassIndex::get_stats() const
+    {
+        MutexLock lock(lock_);
+        Stats stats;
+        stats.entries = entries_.size();
+        stats.stat_hits = stat_hits_;
+        stats.hash_hits = hash_hits_;
+        stats.parsed = parsed_;
+        return stats;
+    }
+
+    void GlobalClassIndex::clear()
+    {
+        MutexLock lock(lock_);
+        entries_.clear();
+        dirty_ = true;
+    }
+}
@@ -0,0 +1,78 @@
+#ifndef GODOTJS_GLOBAL_CLASS_INDEX_H
+#define GODOTJS_GLOBAL_CLASS_INDEX_H
+
+#include "jsb_internal_pch.h"
+
+namespace jsb::internal
+{
+    struct GlobalClassInfo
+    {
+        // empty if no global class declared in the script
+        String class_name;
+        String base_type;
+        String icon_path;
+        bool is_tool = false;
+    };
+
+    // A persistent index of the global classes declared in script files (path => mtime, hash, class info).
+    // `GodotJSScriptLanguage::get_global_class_name` is called by EditorFileSystem for every script on every scan,
+    // with this index, an unchanged file costs only a stat, and a touched but unchanged file (e.g. rewritten by tsc) costs a hash.
+    // The modified time has only 1 second resolution, a file modified too close to the time it was hashed is always hashed again.
+    class GlobalClassIndex
+    {
+    public:
+        struct Stats
+        {
+            int entries = 0;
+            // found by the modified time
+            uint64_t stat_hits = 0;
+            // modified time changed, but found by the content hash
+            uint64_t hash_hits = 0;
+            uint64_t parsed = 0;
+        };
+
+        // [thread safe] get the global class declared in a script file, return false if the file is not readable
+        bool get(const String& p_path, GlobalClassInfo& r_info);
+
+        // [thread safe] load the index file (entries already in memory are kept)
+        Error load(const String& p_index_path);
+
+        // [thread safe] write the index file if anything changed since the last load/save,
+        // the entries of the deleted files are dropped before writing.
+        Error save(const String& p_index_path);
+
+        bool is_dirty() const;
+        Stats get_stats() const;
+        void clear();
+
+        // extract the global class from the source code with a lightweight tokenizer (comments and strings are skipped).
+        // Please follow the rules of the class name declaration in the source code.
+        //     * .ts files: `export default class ClassName extends BaseClassName` (decorated with optional `@tool()` and `@icon("path")`)
+        //     * .js files: `exports.default = class ClassName extends BaseClassName`,
+        //                  or `class ClassName extends BaseClassName` and `exports.default = ClassName` (with or without `;`)
+        static bool parse(const String& p_source, bool p_is_javascript, GlobalClassInfo& r_info);
+
+    private:
+        struct Entry
+        {
+            uint64_t time_modified = 0;
+            // unix time when the content was hashed
+            uint64_t time_scanned = 0;
+            String hash;
+            GlobalClassInfo info;
+        };
+
+        // the content may have changed within the same second after it was hashed, the modified time can not tell it
+        static bool is_racy(const Entry& p_entry);
+
+        mutable BinaryMutex lock_;
+        HashMap<String, Entry> entries_;
+        bool dirty_ = false;
+
+        uint64_t stat_hits_ = 0;
+        uint64_t hash_hits_ = 0;
+        uint64_t parsed_ = 0;
+    };
+}
+
+#endif
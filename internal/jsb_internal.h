@@ -9,11 +9,13 @@
 #include "jsb_logger.h"
 #include "jsb_string_names.h"
 #include "jsb_source_reader.h"
+#include "jsb_file_manager.h"
 #include "jsb_source_map.h"
 #include "jsb_source_map_cache.h"
 #include "jsb_timer_manager.h"
 
 #include "jsb_console_output.h"
+#include "jsb_async_logger.h"
 #include "jsb_path_util.h"
 #include "jsb_variant_util.h"
 #include "jsb_settings.h"
@@ -21,6 +23,7 @@
 #include "jsb_function_pointer.h"
 #include "jsb_typealias.h"
 #include "jsb_benchmark.h"
+#include "jsb_call_profiler.h"
 
 #include "jsb_variant_info.h"
 #include "jsb_variant_allocator.h"
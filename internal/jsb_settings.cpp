@@ -22,6 +22,18 @@ namespace jsb::internal
 
     static constexpr char kRtDebuggerPort[] =     JSB_MODULE_NAME_STRING "/runtime/debugger/debugger_port";
     static constexpr char kRtSourceMapEnabled[] = JSB_MODULE_NAME_STRING "/runtime/logger/source_map_enabled";
+    static constexpr char kRtLoggerMaxStackDepth[] = JSB_MODULE_NAME_STRING "/runtime/logger/max_stack_depth";
+    static constexpr char kRtLoggerAsyncEnabled[] = JSB_MODULE_NAME_STRING "/runtime/logger/async_enabled";
+    static constexpr char kRtLoggerAsyncBufferSize[] = JSB_MODULE_NAME_STRING "/runtime/logger/async_buffer_size";
+    static constexpr char kRtLoggerAsyncRateLimit[] = JSB_MODULE_NAME_STRING "/runtime/logger/async_rate_limit";
+    static constexpr char kRtLoggerAsyncWarningRateLimit[] = JSB_MODULE_NAME_STRING "/runtime/logger/async_warning_rate_limit";
+    static constexpr char kRtArrayBufferPoolLimit[] = JSB_MODULE_NAME_STRING "/runtime/core/array_buffer_pool_limit";
+    static constexpr char kRtMemorySoftLimit[] = JSB_MODULE_NAME_STRING "/runtime/memory/soft_limit_mb";
+    static constexpr char kRtMemoryHardLimit[] = JSB_MODULE_NAME_STRING "/runtime/memory/hard_limit_mb";
+    static constexpr char kRtWorkerMemorySoftLimit[] = JSB_MODULE_NAME_STRING "/runtime/memory/worker_soft_limit_mb";
+    static constexpr char kRtWorkerMemoryHardLimit[] = JSB_MODULE_NAME_STRING "/runtime/memory/worker_hard_limit_mb";
+    static constexpr char kRtShadowEnvironmentPoolSize[] = JSB_MODULE_NAME_STRING "/runtime/threading/shadow_environment_pool_size";
+    static constexpr char kRtShadowEnvironmentPrewarmNum[] = JSB_MODULE_NAME_STRING "/runtime/threading/shadow_environment_prewarm_num";
     static constexpr char kRtAdditionalSearchPaths[] = JSB_MODULE_NAME_STRING "/runtime/core/additional_search_paths";
     static constexpr char kRtEntryScriptPath[] = JSB_MODULE_NAME_STRING "/runtime/core/entry_script_path";
 
@@ -76,6 +88,18 @@ namespace jsb::internal
 
             _GLOBAL_DEF(kRtDebuggerPort, 9229, JSB_SET_RESTART(true), JSB_SET_IGNORE_DOCS(false), JSB_SET_BASIC(false), JSB_SET_INTERNAL(false));
             _GLOBAL_DEF(kRtSourceMapEnabled, true, JSB_SET_RESTART(false), JSB_SET_IGNORE_DOCS(false), JSB_SET_BASIC(true),  JSB_SET_INTERNAL(false));
+            _GLOBAL_DEF(PropertyInfo(Variant::INT, kRtLoggerMaxStackDepth, PROPERTY_HINT_RANGE, "1," JSB_STRINGIFY(JSB_MAX_STACKTRACE_DEPTH) ",1"), 10, JSB_SET_RESTART(false), JSB_SET_IGNORE_DOCS(false), JSB_SET_BASIC(false), JSB_SET_INTERNAL(false));
+            _GLOBAL_DEF(kRtLoggerAsyncEnabled, false, JSB_SET_RESTART(true), JSB_SET_IGNORE_DOCS(false), JSB_SET_BASIC(false), JSB_SET_INTERNAL(false));
+            _GLOBAL_DEF(PropertyInfo(Variant::INT, kRtLoggerAsyncBufferSize, PROPERTY_HINT_RANGE, "16,65536,1"), 4096, JSB_SET_RESTART(true), JSB_SET_IGNORE_DOCS(false), JSB_SET_BASIC(false), JSB_SET_INTERNAL(false));
+            _GLOBAL_DEF(PropertyInfo(Variant::INT, kRtLoggerAsyncRateLimit, PROPERTY_HINT_RANGE, "0,100000,1"), 0, JSB_SET_RESTART(true), JSB_SET_IGNORE_DOCS(false), JSB_SET_BASIC(false), JSB_SET_INTERNAL(false));
+            _GLOBAL_DEF(PropertyInfo(Variant::INT, kRtLoggerAsyncWarningRateLimit, PROPERTY_HINT_RANGE, "0,100000,1"), 0, JSB_SET_RESTART(true), JSB_SET_IGNORE_DOCS(false), JSB_SET_BASIC(false), JSB_SET_INTERNAL(false));
+            _GLOBAL_DEF(PropertyInfo(Variant::INT, kRtArrayBufferPoolLimit, PROPERTY_HINT_RANGE, "0,268435456,1"), JSB_ARRAY_BUFFER_POOL_LIMIT, JSB_SET_RESTART(true), JSB_SET_IGNORE_DOCS(false), JSB_SET_BASIC(false), JSB_SET_INTERNAL(false));
+            _GLOBAL_DEF(PropertyInfo(Variant::INT, kRtMemorySoftLimit, PROPERTY_HINT_RANGE, "0,65536,1,suffix:MB"), 0, JSB_SET_RESTART(true), JSB_SET_IGNORE_DOCS(false), JSB_SET_BASIC(false), JSB_SET_INTERNAL(false));
+            _GLOBAL_DEF(PropertyInfo(Variant::INT, kRtMemoryHardLimit, PROPERTY_HINT_RANGE, "0,65536,1,suffix:MB"), 0, JSB_SET_RESTART(true), JSB_SET_IGNORE_DOCS(false), JSB_SET_BASIC(false), JSB_SET_INTERNAL(false));
+            _GLOBAL_DEF(PropertyInfo(Variant::INT, kRtWorkerMemorySoftLimit, PROPERTY_HINT_RANGE, "0,65536,1,suffix:MB"), 0, JSB_SET_RESTART(true), JSB_SET_IGNORE_DOCS(false), JSB_SET_BASIC(false), JSB_SET_INTERNAL(false));
+            _GLOBAL_DEF(PropertyInfo(Variant::INT, kRtWorkerMemoryHardLimit, PROPERTY_HINT_RANGE, "0,65536,1,suffix:MB"), 0, JSB_SET_RESTART(true), JSB_SET_IGNORE_DOCS(false), JSB_SET_BASIC(false), JSB_SET_INTERNAL(false));
+            _GLOBAL_DEF(PropertyInfo(Variant::INT, kRtShadowEnvironmentPoolSize, PROPERTY_HINT_RANGE, "0,64,1"), JSB_MAX_CACHED_SHADOW_ENVIRONMENTS, JSB_SET_RESTART(true), JSB_SET_IGNORE_DOCS(false), JSB_SET_BASIC(false), JSB_SET_INTERNAL(false));
+            _GLOBAL_DEF(PropertyInfo(Variant::INT, kRtShadowEnvironmentPrewarmNum, PROPERTY_HINT_RANGE, "0,64,1"), JSB_SHADOW_ENVIRONMENT_PREWARM_NUM, JSB_SET_RESTART(true), JSB_SET_IGNORE_DOCS(false), JSB_SET_BASIC(false), JSB_SET_INTERNAL(false));
             _GLOBAL_DEF(kRtAdditionalSearchPaths, PackedStringArray(), JSB_SET_RESTART(true),  JSB_SET_IGNORE_DOCS(false), JSB_SET_BASIC(true),  JSB_SET_INTERNAL(false));
 
             {
@@ -151,6 +175,92 @@ namespace jsb::internal
         return GLOBAL_GET(kRtSourceMapEnabled);
     }
 
+    int Settings::get_logger_max_stack_depth()
+    {
+        init_settings();
+        const int depth = GLOBAL_GET(kRtLoggerMaxStackDepth);
+        return CLAMP(depth, 1, JSB_MAX_STACKTRACE_DEPTH);
+    }
+
+    bool Settings::get_logger_async_enabled()
+    {
+        init_settings();
+        return GLOBAL_GET(kRtLoggerAsyncEnabled);
+    }
+
+    int Settings::get_logger_async_buffer_size()
+    {
+        init_settings();
+        const int size = GLOBAL_GET(kRtLoggerAsyncBufferSize);
+        return CLAMP(size, 16, 65536);
+    }
+
+    int Settings::get_logger_async_rate_limit()
+    {
+        init_settings();
+        const int limit = GLOBAL_GET(kRtLoggerAsyncRateLimit);
+        return MAX(limit, 0);
+    }
+
+    int Settings::get_logger_async_warning_rate_limit()
+    {
+        init_settings();
+        const int limit = GLOBAL_GET(kRtLoggerAsyncWarningRateLimit);
+        return MAX(limit, 0);
+    }
+
+    int Settings::get_array_buffer_pool_limit()
+    {
+        init_settings();
+        const int limit = GLOBAL_GET(kRtArrayBufferPoolLimit);
+        return MAX(limit, 0);
+    }
+
+    int Settings::get_shadow_environment_pool_size()
+    {
+        init_settings();
+        const int size = GLOBAL_GET(kRtShadowEnvironmentPoolSize);
+        return MAX(size, 0);
+    }
+
+    int Settings::get_shadow_environment_prewarm_num()
+    {
+        init_settings();
+        const int num = GLOBAL_GET(kRtShadowEnvironmentPrewarmNum);
+        // never warm more than the pool could keep
+        return CLAMP(num, 0, get_shadow_environment_pool_size());
+    }
+
+    static uint64_t get_memory_limit_setting(const char* p_name)
+    {
+        const int64_t limit_mb = GLOBAL_GET(p_name);
+        return (uint64_t) MAX(limit_mb, 0) * 1024 * 1024;
+    }
+
+    uint64_t Settings::get_memory_soft_limit()
+    {
+        init_settings();
+        return get_memory_limit_setting(kRtMemorySoftLimit);
+    }
+
+    uint64_t Settings::get_memory_hard_limit()
+    {
+        init_settings();
+        return get_memory_limit_setting(kRtMemoryHardLimit);
+    }
+
+    uint64_t Settings::get_worker_memory_soft_limit()
+    {
+        init_settings();
+        return get_memory_limit_setting(kRtWorkerMemorySoftLimit);
+    }
+
+    uint64_t Settings::get_worker_memory_hard_limit()
+    {
+        init_settings();
+        return get_memory_limit_setting(kRtWorkerMemoryHardLimit);
+    }
+
     String Settings::get_project_data_dir_name()
     {
         const String project_data_dir = ProjectSettings::get_singleton()->get_project_data_dir_name();
@@ -173,6 +283,16 @@ namespace jsb::internal
         return "res://" + get_jsb_out_dir_name();
     }
 
+    String Settings::get_global_class_index_path()
+    {
+        return "res://" + get_project_data_dir_name().path_join("godotjs_global_classes.bin");
+    }
+
+    String Settings::get_dts_cache_path()
+    {
+        return "res://" + get_project_data_dir_name().path_join("godotjs_dts_cache.json");
+    }
+
     PackedStringArray Settings::get_additional_search_paths()
     {
         init_settings();
@@ -12,6 +12,39 @@ namespace jsb::internal
         static uint16_t get_debugger_port();
         static bool get_sourcemap_enabled();
 
+        // max number of stack frames captured for `console.trace` (clamped by `JSB_MAX_STACKTRACE_DEPTH`)
+        static int get_logger_max_stack_depth();
+
+        // buffer console outputs and write them on a dedicated thread (errors are always written immediately)
+        static bool get_logger_async_enabled();
+
+        // capacity of the log buffer of each environment (messages are dropped if it's full)
+        static int get_logger_async_buffer_size();
+
+        // max messages per second for each log level below warning in each environment (0 for unlimited)
+        static int get_logger_async_rate_limit();
+
+        // max warnings per second in each environment (0 for unlimited), errors are never limited
+        static int get_logger_async_warning_rate_limit();
+
+        // max bytes of the recycled ArrayBuffer blocks kept by each environment (0 to disable pooling)
+        static int get_array_buffer_pool_limit();
+
+        // max num of idle shadow environments kept for reusing (shadow environments are used on the resource loader threads)
+        static int get_shadow_environment_pool_size();
+
+        // num of idle shadow environments initialized in background ahead of demand (not greater than the pool size)
+        static int get_shadow_environment_prewarm_num();
+
+        // memory limits (in bytes, 0 for unlimited) of the main environment.
+        // memory pressure events are raised approaching the soft limit, and allocations fail beyond the hard limit.
+        static uint64_t get_memory_soft_limit();
+        static uint64_t get_memory_hard_limit();
+
+        // default memory limits (in bytes, 0 for unlimited) of workers, could be overridden in the JSWorker constructor
+        static uint64_t get_worker_memory_soft_limit();
+        static uint64_t get_worker_memory_hard_limit();
+
         /**
          * get the project relative path for `outDir` (it refers to `.godot/GodotJS` by default)
          */
@@ -27,6 +60,16 @@ namespace jsb::internal
          */
         static String get_jsb_out_res_path();
 
+        /**
+         * get the res path of the persistent global class index (.godot/godotjs_global_classes.bin)
+         */
+        static String get_global_class_index_path();
+
+        /**
+         * get the res path of the cache for the incremental d.ts codegen (.godot/godotjs_dts_cache.json)
+         */
+        static String get_dts_cache_path();
+
         static String get_indentation();
 
         static String get_project_data_dir_name();
@@ -1,5 +1,7 @@
 #include "jsb_source_map.h"
 
+#include <algorithm>
+
 namespace jsb::internal
 {
     namespace
@@ -17,19 +19,20 @@ namespace jsb::internal
         };
     }
 
-    // base64vlq decode
+    // base64vlq decode a single segment
     // adapted from https://www.murzwin.com/base64vlq.html
-    void SourceMap::decode(int p_line, const char* p_token, const char* p_end, InternalPosition& r_pos, int& r_aline, int& r_acol)
+    // returns the number of decoded fields
+    int SourceMap::decode_segment(const char* p_token, const char* p_end, int (&r_fields)[5])
     {
-        if (p_end - p_token <= 1) return;
         uint8_t shift = 0;
         int32_t value = 0;
-        uint8_t index = 0;
-        while (p_end != p_token)
+        int index = 0;
+        while (p_end != p_token && index < 5)
         {
             const char token = *(p_token++);
-            jsb_check(token >= '+' && token <= 'z');
+            if (jsb_unlikely(token < '+' || token > 'z')) return 0;
             int32_t integer = kBase64Unmap[(uint8_t) (token - '+')];
+            if (jsb_unlikely(integer == 0xff)) return 0;
             const bool cont = integer & 0x20;
             integer &= 0x1f;
             value |= integer << shift;
@@ -39,95 +42,115 @@ namespace jsb::internal
             }
             const bool neg = value & 1;
             value = value >> 1;
-            r_pos[index++] = neg ? -value : value;
+            r_fields[index++] = neg ? -value : value;
             value = shift = 0;
         }
-        r_aline += r_pos.source_line;
-        r_acol += r_pos.source_column;
-        Vector<InternalPosition>& elements = (*this)[p_line].elements;
-        elements.append({ r_pos.result_column, r_pos.source_index, r_aline, r_acol, r_pos._reserved });
+        return index;
     }
 
-    SourceMap::InternalLine& SourceMap::operator[](int p_line)
+    void SourceMap::decode_line(const char* p_begin, const char* p_end)
     {
-        const int size = source_lines_.size();
-        if (size == 0 || source_lines_[size - 1].result_line != p_line)
+        // the generated column is relative to the previous segment in the same line only
+        int generated_column = 0;
+        bool sorted = true;
+        const int first = segments_.size();
+        const char* pos = p_begin;
+        while (pos < p_end)
+        {
+            const char* next = pos;
+            while (next < p_end && *next != ',') ++next;
+
+            int fields[5];
+            const int num = decode_segment(pos, next, fields);
+            pos = next + 1;
+            if (num == 0) continue;
+            generated_column += fields[0];
+            // a segment with only one field has no source position
+            if (num < 4) continue;
+            state_.source_index += fields[1];
+            state_.source_line += fields[2];
+            state_.source_column += fields[3];
+            if (num == 5) state_.name_index += fields[4];
+
+            const int size = segments_.size();
+            if (size != first && segments_[size - 1].generated_column > generated_column) sorted = false;
+            segments_.push_back({ generated_column, state_.source_index, state_.source_line, state_.source_column });
+        }
+
+        // segments are usually emitted in order, it's just a guard for the binary search in `find`
+        if (jsb_unlikely(!sorted))
         {
-            source_lines_.push_back({ {}, p_line });
-            return source_lines_.write[size];
+            Segment* ptr = segments_.ptrw();
+            std::sort(ptr + first, ptr + segments_.size(), [](const Segment& a, const Segment& b) { return a.generated_column < b.generated_column; });
         }
-        return source_lines_.write[size - 1];
+        segment_offsets_.push_back(segments_.size());
     }
 
-    bool SourceMap::parse_mappings(const char* p_mappings, size_t p_len)
+    void SourceMap::decode_lines(int p_line)
     {
-        source_lines_.clear();
-        int line = 0;
-        size_t pos = 0;
-        size_t cursor = 0;
-        int accum_line = 0;
-        int accum_column = 0;
-        InternalPosition sp;
-        while (cursor < p_len)
+        const char* mappings = mappings_.ptr();
+        for (int line = get_decoded_line_count(); line <= p_line; ++line)
         {
-            const char ch = p_mappings[cursor];
-            switch (ch)
-            {
-            case ';':
-                // new line
-                decode(line, p_mappings + pos, p_mappings + cursor, sp, accum_line, accum_column);
-                ++line;
-                pos = ++cursor;
-                break;
-            case ',':
-                // new element
-                jsb_check(pos < cursor);
-                decode(line, p_mappings + pos, p_mappings + cursor, sp, accum_line, accum_column);
-                pos = ++cursor;
-                break;
-            default: ++cursor; break;
-            }
+            decode_line(mappings + line_offsets_[line], mappings + line_offsets_[line + 1] - 1);
         }
-        if (pos < cursor)
+    }
+
+    bool SourceMap::parse_mappings(const char* p_mappings, size_t p_len)
+    {
+        mappings_.resize((int) p_len);
+        memcpy(mappings_.ptrw(), p_mappings, p_len);
+
+        // only index the generated lines here, the segments are decoded lazily in `find`
+        line_offsets_.clear();
+        line_offsets_.push_back(0);
+        for (const char* it = p_mappings, *end = p_mappings + p_len; it != end; ++it)
         {
-            decode(line, p_mappings + pos, p_mappings + cursor, sp, accum_line, accum_column);
+            if (*it == ';') line_offsets_.push_back((int) (it - p_mappings) + 1);
         }
+        // a virtual terminator for the last line
+        line_offsets_.push_back((int) p_len + 1);
+
+        segments_.clear();
+        segment_offsets_.clear();
+        segment_offsets_.push_back(0);
+        state_ = {};
         return true;
     }
 
-    bool SourceMap::find(int p_line, int p_column, IndexedSourcePosition& r_pos) const
+    bool SourceMap::find(int p_line, int p_column, IndexedSourcePosition& r_pos)
     {
-        for (int line_index = source_lines_.size() - 1; line_index >= 0; --line_index)
+        const int line_count = get_line_count();
+        if (p_line >= 0 && line_count > 0)
         {
-            const InternalLine& line = source_lines_[line_index];
-            if (line.result_line > p_line)
+            int line = MIN(p_line, line_count - 1);
+            if (line >= get_decoded_line_count())
             {
-                continue;
+                decode_lines(line);
             }
 
-            int xdist = INT_MAX;
-            int xindex = 0;
-            for (int index = line.elements.size() - 1; index >= 0; -- index)
+            // use the nearest previous line if no segment mapped in this line
+            const Segment* segments = segments_.ptr();
+            const int* offsets = segment_offsets_.ptr();
+            while (line >= 0 && offsets[line] == offsets[line + 1]) --line;
+            if (line >= 0)
             {
-                const InternalPosition& position = line.elements[index];
-                const int dist = std::abs(position.result_column - p_column);
-                if (dist == 0)
+                // find the last segment which generated column is not greater than `p_column`
+                int lo = offsets[line];
+                int hi = offsets[line + 1];
+                const int first = lo;
+                while (lo < hi)
                 {
-                    xindex = index;
-                    break;
+                    const int mid = lo + ((hi - lo) >> 1);
+                    if (segments[mid].generated_column <= p_column) lo = mid + 1;
+                    else hi = mid;
                 }
-                if (dist < xdist)
-                {
-                    xdist = dist;
-                    xindex = index;
-                }
-            }
 
-            const InternalPosition& xposition = line.elements[xindex];
-            r_pos.index = xposition.source_index;
-            r_pos.line = xposition.source_line;
-            r_pos.column = xposition.source_column;
-            return true;
+                const Segment& segment = segments[lo == first ? first : lo - 1];
+                r_pos.index = segment.source_index;
+                r_pos.line = segment.source_line;
+                r_pos.column = segment.source_column;
+                return true;
+            }
         }
         // no matched position
         r_pos.index = r_pos.line = r_pos.column = 0;
@@ -139,6 +162,7 @@ namespace jsb::internal
         const Variant json = JSON::parse_string(p_source_map);
         const CharString mappings = ((String) json.get("mappings")).utf8();
         source_root_ = (String) json.get("sourceRoot");
+        sources_.clear();
         Array sources = (Array) json.get("sources");
         for (int i = 0, n = sources.size(); i < n; ++i)
         {
@@ -149,7 +173,11 @@ namespace jsb::internal
 
     const String& SourceMap::get_source(int index) const
     {
-        jsb_check(index >= 0 && index < sources_.size());
+        if (jsb_unlikely(index < 0 || index >= sources_.size()))
+        {
+            static const String empty;
+            return empty;
+        }
         return sources_[index];
     }
 
@@ -20,28 +20,42 @@ namespace jsb::internal
         int column = 0;
     };
 
+    // A compact index of the `mappings` in a source map.
+    // The raw mappings are kept as is, only the line offsets are indexed on parsing.
+    // Generated lines are decoded lazily (in order, since the VLQ fields are relative to the previous segment) on the first lookup,
+    // and positions are found by binary search in the decoded segments of the generated line.
     struct SourceMap
     {
     private:
-        struct InternalPosition
+        struct Segment
         {
-            // DO NOT CHANGE THE ORDER
-            int result_column = 0;
+            int generated_column = 0;
             int source_index = 0;
             int source_line = 0;
             int source_column = 0;
-            int _reserved = 0; // name index
-
-            jsb_force_inline int& operator[](uint8_t index) { jsb_check(index < 5); return *((int*)this + index); }
         };
 
-        struct InternalLine
+        // accumulated fields carried across the generated lines
+        struct DecoderState
         {
-            Vector<InternalPosition> elements;
-            int result_line = 0;
+            int source_index = 0;
+            int source_line = 0;
+            int source_column = 0;
+            int name_index = 0;
         };
 
-        Vector<InternalLine> source_lines_;
+        // raw `mappings` string (without the null terminator)
+        Vector<char> mappings_;
+
+        // [line_offsets_[i], line_offsets_[i + 1] - 1) is the range of generated line `i` in `mappings_`
+        Vector<int> line_offsets_;
+
+        // [segment_offsets_[i], segment_offsets_[i + 1]) is the range of decoded segments of generated line `i` in `segments_`
+        // the number of decoded lines is `segment_offsets_.size() - 1`
+        Vector<int> segment_offsets_;
+        Vector<Segment> segments_;
+        DecoderState state_;
+
         Vector<String> sources_;
         String source_root_;
 
@@ -55,14 +69,20 @@ namespace jsb::internal
         // input: js source position [line, column]
         // output: ts source position
         //NOTE line & column are both zero-based
-        bool find(int p_line, int p_column, IndexedSourcePosition& r_pos) const;
+        //NOTE not const, the generated lines are decoded lazily on demand
+        bool find(int p_line, int p_column, IndexedSourcePosition& r_pos);
 
         const String& get_source_root() const;
         const String& get_source(int index) const;
 
+        jsb_force_inline int get_line_count() const { return line_offsets_.size() - 1; }
+        jsb_force_inline int get_decoded_line_count() const { return segment_offsets_.size() - 1; }
+
     private:
-        void decode(int p_line, const char* p_token, const char* p_end, InternalPosition& r_pos, int& r_aline, int& r_acol);
-        InternalLine& operator[](int p_line);
+        // decode all generated lines until `p_line` (inclusive)
+        void decode_lines(int p_line);
+        void decode_line(const char* p_begin, const char* p_end);
+        static int decode_segment(const char* p_token, const char* p_end, int (&r_fields)[5]);
     };
 }
 #endif
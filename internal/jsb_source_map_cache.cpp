@@ -44,13 +44,14 @@ namespace jsb::internal
         if (!internal::Settings::get_sourcemap_enabled()) return p_stacktrace;
         if (p_stacktrace.length() == 0) return p_stacktrace;
 
+        MutexLock lock(lock_);
         bool is_position_set = r_position == nullptr;
         Vector<String> st_lines = p_stacktrace.split("\n");
         MatchResult result;
         for (String& st_line : st_lines)
         {
             if (!match(st_line, result)) continue;
-            const SourceMap* map = find_source_map(result.filename);
+            SourceMap* map = find_source_map(result.filename);
             if (!map) continue;
             IndexedSourcePosition position;
             if (!map->find(result.line, result.col, position)) continue;
@@ -84,8 +85,27 @@ namespace jsb::internal
         return ret;
     }
 
+    bool SourceMapCache::translate(SourcePosition& r_position)
+    {
+        if (!internal::Settings::get_sourcemap_enabled()) return false;
+        if (r_position.filename.is_empty()) return false;
+
+        MutexLock lock(lock_);
+        SourceMap* map = find_source_map(r_position.filename);
+        if (!map) return false;
+        IndexedSourcePosition position;
+        if (!map->find(r_position.line, r_position.column, position)) return false;
+        const String& source = map->get_source(position.index);
+        const String& source_root = map->get_source_root();
+        r_position.filename = PathUtil::to_platform_specific_path(PathUtil::combine("res://", source_root, source));
+        r_position.line = position.line;
+        r_position.column = position.column;
+        return true;
+    }
+
     void SourceMapCache::invalidate(const String& p_filename)
     {
+        MutexLock lock(lock_);
         if (cached_source_maps_.erase(p_filename))
         {
             JSB_LOG(Verbose, "invalidating source map cache of file %s", p_filename);
@@ -94,6 +114,7 @@ namespace jsb::internal
 
     void SourceMapCache::clear()
     {
+        MutexLock lock(lock_);
         source_map_match1_.unref();
         source_map_match2_.unref();
         cached_source_maps_.clear();
@@ -119,7 +140,26 @@ namespace jsb::internal
         return &map;
     }
 #else
-    String SourceMapCache::process_source_position(const String& p_stacktrace) { return p_stacktrace; }
+    String SourceMapCache::process_source_position(const String& p_stacktrace, SourcePosition* r_position) { return p_stacktrace; }
+    bool SourceMapCache::translate(SourcePosition& r_position) { return false; }
     void SourceMapCache::invalidate(const String& p_filename) {}
+    void SourceMapCache::clear() {}
 #endif
+
+    String SourceMapCache::format_stacktrace(const SourcePosition* p_frames, int p_num)
+    {
+        String ret;
+        for (int index = 0; index < p_num; ++index)
+        {
+            const SourcePosition& frame = p_frames[index];
+            const String location = frame.filename.is_empty()
+                ? String("native")
+                : frame.column > 0 ? jsb_format("%s:%d:%d", frame.filename, frame.line, frame.column) : jsb_format("%s:%d", frame.filename, frame.line);
+
+            if (!ret.is_empty()) ret += "\n";
+            if (frame.function.is_empty()) ret += jsb_format("    at %s", location);
+            else ret += jsb_format("    at %s (%s)", frame.function, location);
+        }
+        return ret;
+    }
 }
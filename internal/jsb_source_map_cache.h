@@ -7,11 +7,18 @@
 
 namespace jsb::internal
 {
+    // [thread safe] it's also used by the flush thread of AsyncLogger to resolve the log entries
     struct SourceMapCache
     {
         // try to translate the source positions in stacktrace
         String process_source_position(const String& p_stacktrace, SourcePosition* r_position = nullptr);
 
+        // try to translate a raw js source position (captured from the stack frames) into the original source position in-place
+        bool translate(SourcePosition& r_position);
+
+        // format the (translated or not) stack frames as a stacktrace string
+        static String format_stacktrace(const SourcePosition* p_frames, int p_num);
+
         void invalidate(const String& p_filename);
 
         void clear();
@@ -31,6 +38,7 @@ namespace jsb::internal
         SourceMap* find_source_map(const String& p_filename);
         bool match(const String& p_line, MatchResult& r_result);
 
+        BinaryMutex lock_;
         Ref<RegEx> source_map_match1_;
         Ref<RegEx> source_map_match2_;
         HashMap<String, SourceMap> cached_source_maps_;
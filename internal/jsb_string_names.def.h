@@ -17,6 +17,7 @@ DEF(loaded)
 DEF(name)
 DEF(main)
 DEF(cache)
+DEF(async)
 DEF(children)
 DEF(type)
 DEF(evaluator)
@@ -65,6 +65,38 @@
 // translate the js source stacktrace with source map (currently, the `.map` file must locate at the same filename & directory of the js source)
 #define JSB_WITH_SOURCEMAP 1
 
+// the upper limit of stack frames captured for `console.trace` (see `runtime/logger/max_stack_depth` in project settings)
+#define JSB_MAX_STACKTRACE_DEPTH 64
+
+// record script calls (engine to JS), native calls (JS to engine) and module loads for profiling (also available in release builds).
+// the overhead is a single relaxed atomic load per call while the profiler is not running.
+#define JSB_WITH_CALL_PROFILER 1
+
+// capacity of the per-thread event buffer of the call profiler (events are dropped if it's full before collected)
+#define JSB_CALL_PROFILER_THREAD_BUFFER_SIZE (1024 * 16)
+
+// upper limit of events kept for the trace export (about 40 bytes per event)
+#define JSB_CALL_PROFILER_MAX_TRACE_EVENTS (1024 * 1024)
+
+// count the calls across the bridge and the Variant conversions in each Environment (see `BridgeCounters`)
+#define JSB_WITH_BRIDGE_COUNTERS 1
+
+// num of slots of the short String value cache in each Environment (see `StringValueCache`), must be a power of 2, 0 to disable
+#define JSB_STRING_VALUE_CACHE_SIZE 256
+
+// max length of the String values cached by `StringValueCache`
+#define JSB_STRING_VALUE_CACHE_MAX_LENGTH 32
+
+// default max bytes of the recycled ArrayBuffer blocks kept by each Environment (see `ArrayBufferAllocator`),
+// overridden by the project setting `runtime/core/array_buffer_pool_limit`
+#define JSB_ARRAY_BUFFER_POOL_LIMIT (1024 * 1024 * 4)
+
+// percentage of the soft memory limit of an Environment to raise the `moderate` memory pressure event (see `MemoryBudget`)
+#define JSB_MEMORY_PRESSURE_MODERATE_PERCENT 80
+
+// min interval (in milliseconds) between the automatic GCs triggered by reaching the soft memory limit
+#define JSB_MEMORY_BUDGET_GC_INTERVAL 1000
+
 // log with C++ [source filename, line number, function name]
 #define JSB_LOG_WITH_SOURCE 0
 
@@ -94,6 +126,12 @@
 // implicitly convert a javascript array as godot Vector<T> which is convenient but less performant if massively used
 #define JSB_IMPLICIT_PACKED_ARRAY_CONVERSION 1
 
+// implicitly convert a plain javascript object (with Object.prototype or null as prototype) as godot Dictionary
+#define JSB_IMPLICIT_DICTIONARY_CONVERSION 1
+
+// max nesting depth of javascript arrays/objects implicitly converted as godot Array/Dictionary
+#define JSB_CONTAINER_CONVERSION_MAX_DEPTH 128
+
 // not to generate method declaration if already defined as get/set property
 #define JSB_EXCLUDE_GETSET_METHODS 1
 
@@ -109,8 +147,42 @@
 #define JSB_THREADING 1
 
 #define JSB_SHADOW_ENVIRONMENT_AS_PARSER 1
+
+// max num of idle shadow environments kept for reusing,
+// overridden by the project setting `runtime/threading/shadow_environment_pool_size`
 #define JSB_MAX_CACHED_SHADOW_ENVIRONMENTS 2
 
+// num of idle shadow environments initialized in background ahead of demand (0 to disable),
+// overridden by the project setting `runtime/threading/shadow_environment_prewarm_num`.
+// with prewarming, the released ones which have run user code are replaced by fresh ones (disposed in background),
+// otherwise they are reused as is (the globals and loaded modules are visible to the next user).
+#define JSB_SHADOW_ENVIRONMENT_PREWARM_NUM 2
+
+// keep the compiled internal bundles (bytecode or code cache) in the process,
+// so that the following environments (workers, shadow environments) skip parsing them on bootstrapping.
+// it's a no-op if not supported by the runtime (web, JavaScriptCore).
+#define JSB_WITH_BOOTSTRAP_CACHE 1
+
+// keep the parsed JSON modules (serialized) in the process,
+// so that the following environments (workers, shadow environments) skip parsing them.
+// it's a no-op if not supported by the runtime (v8, web, JavaScriptCore).
+#define JSB_WITH_JSON_MODULE_CACHE 1
+
+// max bytes of the serialized values kept by `JsonModuleCache` (the least recently used ones are evicted)
+#define JSB_JSON_MODULE_CACHE_BUDGET (32 * 1024 * 1024)
+
+// JSON modules (objects or arrays) larger than it (in bytes) are parsed on the first access of the exports (0 to disable)
+#define JSB_JSON_LAZY_THRESHOLD (256 * 1024)
+
+// min interval (in milliseconds) of writing the global class index file in the editor (only if changed)
+#define JSB_GLOBAL_CLASS_INDEX_SAVE_INTERVAL 5000
+
+// num of I/O threads reading the script sources in background (see `internal::FileManager`, started on demand)
+#define JSB_FILE_IO_THREADS 2
+
+// max bytes of the script sources cached in memory by `internal::FileManager`
+#define JSB_FILE_CACHE_BUDGET (16 * 1024 * 1024)
+
 // slots for object/script/class info is reallocated on heap (as a whole block of memory)
 // a suitable value can avoid unnecessary reallocation
 #define JSB_MASTER_INITIAL_OBJECT_SLOTS (1024 * 64)
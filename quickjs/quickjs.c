@@ -3989,6 +3989,75 @@ JSValue JS_NewStringLen(JSContext *ctx, const char *buf, size_t buf_len)
     return JS_EXCEPTION;
 }
 
+/* GodotJS: create a string from a UTF-32 buffer */
+JSValue JS_NewStringUTF32(JSContext *ctx, const uint32_t *buf, size_t len)
+{
+    JSString *str;
+    uint16_t *q;
+    size_t i, len16;
+    uint32_t c, bits;
+
+    if (len == 0)
+        return JS_AtomToString(ctx, JS_ATOM_empty_string);
+
+    /* a single pass to decide the storage and the UTF-16 length */
+    bits = 0;
+    len16 = len;
+    for (i = 0; i < len; i++) {
+        c = buf[i];
+        bits |= c;
+        if (c >= 0x10000 && c <= 0x10FFFF)
+            len16++;
+    }
+    if (len16 > JS_STRING_LEN_MAX)
+        return JS_ThrowInternalError(ctx, "string too long");
+
+    if (bits < 0x100) {
+        str = js_alloc_string(ctx, len, 0);
+        if (!str)
+            return JS_EXCEPTION;
+        for (i = 0; i < len; i++)
+            str->u.str8[i] = buf[i];
+        str->u.str8[len] = '\0';
+    } else {
+        str = js_alloc_string(ctx, len16, 1);
+        if (!str)
+            return JS_EXCEPTION;
+        q = str->u.str16;
+        for (i = 0; i < len; i++) {
+            c = buf[i];
+            if (c < 0x10000) {
+                *q++ = c;
+            } else if (c <= 0x10FFFF) {
+                /* surrogate pair */
+                c -= 0x10000;
+                *q++ = (c >> 10) + 0xd800;
+                *q++ = (c & 0x3ff) + 0xdc00;
+            } else {
+                *q++ = 0xfffd;
+            }
+        }
+    }
+    return JS_MKPTR(JS_TAG_STRING, str);
+}
+
+/* GodotJS */
+JS_BOOL JS_GetStringBuffer(JSContext *ctx, JSValueConst val, const void **pbuf, uint32_t *plen, JS_BOOL *pwide)
+{
+    JSString *p;
+
+    if (JS_VALUE_GET_TAG(val) != JS_TAG_STRING)
+        return FALSE;
+    p = JS_VALUE_GET_STRING(val);
+    *pwide = p->is_wide_char;
+    *plen = p->len;
+    if (p->is_wide_char)
+        *pbuf = p->u.str16;
+    else
+        *pbuf = p->u.str8;
+    return TRUE;
+}
+
 static JSValue JS_ConcatString3(JSContext *ctx, const char *str1,
                                 JSValue str2, const char *str3)
 {
@@ -6636,6 +6705,39 @@ static void build_backtrace(JSContext *ctx, JSValueConst error_obj,
                            JS_PROP_WRITABLE | JS_PROP_CONFIGURABLE);
 }
 
+/* GodotJS: similar to build_backtrace() but only collects the raw frame info */
+int JS_GetStackFrames(JSContext *ctx, JSStackFrameInfo *frames, int max_frames)
+{
+    JSStackFrame *sf;
+    JSObject *p;
+    JSFunctionBytecode *b;
+    JSStackFrameInfo *fi;
+    int n = 0;
+
+    for(sf = ctx->rt->current_stack_frame; sf != NULL && n < max_frames; sf = sf->prev_frame) {
+        if (JS_VALUE_GET_TAG(sf->cur_func) != JS_TAG_OBJECT)
+            continue;
+        p = JS_VALUE_GET_OBJ(sf->cur_func);
+        if (!js_class_has_bytecode(p->class_id))
+            continue;
+        b = p->u.func.function_bytecode;
+        fi = &frames[n++];
+        fi->func_name = b->func_name;
+        if (b->has_debug) {
+            fi->filename = b->debug.filename;
+            fi->line_num = find_line_num(ctx, b,
+                                         sf->cur_pc - b->byte_code_buf - 1);
+        } else {
+            fi->filename = JS_ATOM_NULL;
+            fi->line_num = -1;
+        }
+        /* stop backtrace if JS_EVAL_FLAG_BACKTRACE_BARRIER was used */
+        if (b->backtrace_barrier)
+            break;
+    }
+    return n;
+}
+
 /* Note: it is important that no exception is returned by this function */
 static BOOL is_backtrace_needed(JSContext *ctx, JSValueConst obj)
 {
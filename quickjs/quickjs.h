@@ -734,6 +734,16 @@ static inline const char *JS_ToCString(JSContext *ctx, JSValueConst val1)
 }
 void JS_FreeCString(JSContext *ctx, const char *ptr);
 
+/* GodotJS: create a string from UTF-32 code points without transcoding through UTF-8.
+   It's stored as a narrow (latin1) string if all code points are below 0x100, or UTF-16 otherwise.
+   Code points above 0x10FFFF are replaced with U+FFFD. */
+JSValue JS_NewStringUTF32(JSContext *ctx, const uint32_t *buf, size_t len);
+
+/* GodotJS: direct access to the characters of a string value.
+   return FALSE if 'val' is not a string. '*pwide' is set to TRUE if the characters are UTF-16 code units,
+   FALSE if latin1. The buffer is only valid while 'val' is alive. */
+JS_BOOL JS_GetStringBuffer(JSContext *ctx, JSValueConst val, const void **pbuf, uint32_t *plen, JS_BOOL *pwide);
+
 JSValue JS_NewObjectProtoClass(JSContext *ctx, JSValueConst proto, JSClassID class_id);
 JSValue JS_NewObjectClass(JSContext *ctx, int class_id);
 JSValue JS_NewObjectProto(JSContext *ctx, JSValueConst proto);
@@ -945,6 +955,18 @@ JSAtom JS_GetScriptOrModuleName(JSContext *ctx, int n_stack_levels);
 JSValue JS_LoadModule(JSContext *ctx, const char *basename,
                       const char *filename);
 
+/* GodotJS: raw stack frame info, captured without creating an Error object.
+   The atoms are not duplicated, they are only valid until the frames unwind. */
+typedef struct JSStackFrameInfo {
+    JSAtom func_name; /* JS_ATOM_NULL if anonymous */
+    JSAtom filename; /* JS_ATOM_NULL if no debug info */
+    int line_num; /* -1 if unknown */
+} JSStackFrameInfo;
+
+/* GodotJS: walk the current bytecode stack frames (native frames are skipped).
+   return the number of frames written into 'frames' */
+int JS_GetStackFrames(JSContext *ctx, JSStackFrameInfo *frames, int max_frames);
+
 /* C function definition */
 typedef enum JSCFunctionEnum {  /* XXX: should rename for namespace isolation */
     JS_CFUNC_generic,
@@ -1,6 +1,7 @@
 
 import {
     DirAccess,
+    Engine,
     FileAccess,
     GDictionary,
     PropertyHint,
@@ -111,6 +112,8 @@ const TypeMutations: Record<string, TypeMutation> = {
             "[Symbol.iterator](): IteratorObject<T>",
             "/** Returns a Proxy that targets this GArray but behaves similar to a JavaScript array. */",
             `proxy(): GArrayProxy<T>`,
+            "/** Returns a JavaScript array with a snapshot of the elements (converted in a single native call). */",
+            "toJS(): T[]",
             "",
             "set_indexed(index: number, value: T): void",
             "get_indexed(index: number): T",
@@ -158,6 +161,8 @@ const TypeMutations: Record<string, TypeMutation> = {
             "[Symbol.iterator](): IteratorObject<{ key: any, value: any }>",
             "/** Returns a Proxy that targets this GDictionary but behaves similar to a regular JavaScript object. Values are exposed as enumerable properties, so Object.keys(), Object.entries() etc. will work. */",
             "proxy(): GDictionaryProxy<T>",
+            "/** Returns a plain JavaScript object with a snapshot of the entries (converted in a single native call). */",
+            "toJS(): T",
             "",
             "set_keyed<K extends keyof T>(key: K, value: T[K]): void",
             "get_keyed<K extends keyof T>(key: K): T[K]",
@@ -1256,51 +1261,74 @@ class PropertyWriter extends AbstractWriter {
     }
 }
 
-class FileWriter extends AbstractWriter {
-    private _file: FileAccess;
+// lines are buffered in memory,
+// written to the file only if the content changed (see `write_file_if_changed`), or cached as the generated code of a class (see `emit_cached`)
+class BufferedWriter extends AbstractWriter {
+    private _lines: string[] = [];
     private _size = 0;
-    private _lineno = 0;
     private _types: TypeDB;
 
-    constructor(types: TypeDB, file: FileAccess) {
+    constructor(types: TypeDB) {
         super();
         this._types = types;
-        this._file = file;
     }
 
     get size() { return this._size; }
-    get lineno() { return this._lineno; }
+    get lineno() { return this._lines.length; }
     get types() { return this._types; }
+    get lines() { return this._lines; }
+    get text() { return this._lines.join("\n") + "\n"; }
 
     line(text: string): void {
-        this._file.store_line(text);
+        this._lines.push(text);
         this._size += text.length;
-        this._lineno += 1;
     }
 
     finish(): void {
-        this._file.flush();
     }
 }
 
+/**
+ * write the file only if the content changed,
+ * the modified time of unchanged files are kept, so that tsc (in incremental mode) will not check them again.
+ * @returns true if the file is written
+ */
+function write_file_if_changed(path: string, content: string): boolean {
+    if (FileAccess.file_exists(path) && FileAccess.get_file_as_string(path) == content) {
+        return false;
+    }
+    const file = FileAccess.open(path, FileAccess.ModeFlags.WRITE);
+    if (!file) {
+        console.error("failed to write file", path);
+        return false;
+    }
+    file.store_string(content);
+    file.close();
+    return true;
+}
+
 class FileSplitter {
-    private _file: FileAccess;
+    private _path: string;
+    private _file: BufferedWriter;
     private _toplevel: ModuleWriter;
     private _types: TypeDB;
 
     constructor(types: TypeDB, filePath: string) {
         this._types = types;
-        this._file = FileAccess.open(filePath, FileAccess.ModeFlags.WRITE);
-        this._toplevel = new ModuleWriter(new FileWriter(this._types, this._file), "godot");
+        this._path = filePath;
+        this._file = new BufferedWriter(this._types);
+        this._toplevel = new ModuleWriter(this._file, "godot");
 
-        this._file.store_line("// AUTO-GENERATED");
-        this._file.store_line('/// <reference no-default-lib="true"/>');
+        this._file.line("// AUTO-GENERATED");
+        this._file.line('/// <reference no-default-lib="true"/>');
     }
 
+    /**
+     * @returns true if the file is written
+     */
     close() {
         this._toplevel.finish();
-        this._file.flush();
-        this._file.close();
+        return write_file_if_changed(this._path, this._file.text);
     }
 
     get_writer() {
@@ -1311,6 +1339,79 @@ class FileSplitter {
     get_lineno() { return this._toplevel.lineno; }
 }
 
+// bump it if the output of the codegen changed without any changes in the input (ClassDB, docs)
+const CodegenCacheVersion = 1;
+
+interface CodegenCacheEntry {
+    fingerprint: string;
+    lines: string[];
+}
+
+// a fast non-cryptographic hash (cyrb53), only used for detecting changes
+function hash_string(str: string, seed: number = 0): string {
+    let h1 = 0xdeadbeef ^ seed, h2 = 0x41c6ce57 ^ seed;
+    for (let i = 0; i < str.length; ++i) {
+        const ch = str.charCodeAt(i);
+        h1 = Math.imul(h1 ^ ch, 2654435761);
+        h2 = Math.imul(h2 ^ ch, 1597334677);
+    }
+    h1 = Math.imul(h1 ^ (h1 >>> 16), 2246822507) ^ Math.imul(h2 ^ (h2 >>> 13), 3266489909);
+    h2 = Math.imul(h2 ^ (h2 >>> 16), 2246822507) ^ Math.imul(h1 ^ (h1 >>> 13), 3266489909);
+    return ("0000000" + (h2 >>> 0).toString(16)).slice(-8) + ("0000000" + (h1 >>> 0).toString(16)).slice(-8);
+}
+
+function fingerprint_of(value: any): string {
+    return hash_string(JSON.stringify(value, (key, v) => typeof v === "bigint" ? v.toString() : v));
+}
+
+// the generated code of classes from the previous run, reused if the fingerprint of the input is not changed
+class CodegenCache {
+    private _path: string | undefined;
+    private _entries: { [name: string]: CodegenCacheEntry } = {};
+    // only the entries used in this run are saved
+    private _used: { [name: string]: CodegenCacheEntry } = {};
+
+    hits = 0;
+    misses = 0;
+
+    constructor(path?: string) {
+        this._path = path;
+        if (typeof path !== "string" || path.length == 0 || !FileAccess.file_exists(path)) {
+            return;
+        }
+        try {
+            const data = JSON.parse(FileAccess.get_file_as_string(path));
+            if (data?.version === CodegenCacheVersion && typeof data.entries === "object") {
+                this._entries = data.entries;
+            }
+        } catch (e) {
+            console.warn("ignore invalid codegen cache", path, e);
+        }
+    }
+
+    get(name: string, fingerprint: string): string[] | undefined {
+        const entry = this._entries[name];
+        if (typeof entry === "object" && entry.fingerprint === fingerprint) {
+            ++this.hits;
+            this._used[name] = entry;
+            return entry.lines;
+        }
+        ++this.misses;
+        return undefined;
+    }
+
+    set(name: string, fingerprint: string, lines: string[]) {
+        this._used[name] = { fingerprint: fingerprint, lines: lines };
+    }
+
+    save() {
+        if (typeof this._path !== "string" || this._path.length == 0) {
+            return;
+        }
+        write_file_if_changed(this._path, JSON.stringify({ version: CodegenCacheVersion, entries: this._used }));
+    }
+}
+
 export class TypeDB {
     singletons: { [name: string]: jsb.editor.SingletonInfo } = {};
     classes: { [name: string]: jsb.editor.ClassInfo } = {};
@@ -1547,12 +1648,69 @@ export class TSDCodeGen {
     private _outDir: string;
     private _splitter: FileSplitter | undefined;
     private _types: TypeDB;
+    private _cache: CodegenCache;
+    private _fingerprint_salt: string;
+    private _written_files = 0;
+    private _unchanged_files = 0;
 
-    constructor(outDir: string) {
+    /**
+     * @param outDir the directory of the generated d.ts files
+     * @param cachePath the generated code of classes is cached in this file for the next run (no cache if not specified)
+     */
+    constructor(outDir: string, cachePath?: string) {
         this._split_index = 0;
         this._outDir = outDir;
 
         this._types = new TypeDB();
+        this._cache = new CodegenCache(cachePath);
+        this._fingerprint_salt = this.make_fingerprint_salt();
+    }
+
+    // the generated code of a class also depends on the engine (docs) and other types (see `TypeDB.make_classname` and `get_type_mutation`)
+    private make_fingerprint_salt() {
+        const type_index: any[] = [];
+        for (let class_name in this._types.classes) {
+            const cls = this._types.classes[class_name];
+            type_index.push([cls.name, cls.super, cls.enums?.map(it => it.name)]);
+        }
+        return fingerprint_of([
+            CodegenCacheVersion,
+            jsb.version,
+            gd_to_string(Engine.get_version_info()),
+            jsb.editor.VERSION_DOCS_URL,
+            type_index,
+            Object.keys(this._types.singletons),
+            Object.keys(this._types.globals),
+            Object.keys(this._types.primitive_types),
+        ]);
+    }
+
+    // generate the code with `emitter`, or reuse the cached code if the input is not changed.
+    // the class doc (written as comments) is a part of the input, docs may change without changing the engine version (e.g. doc-only extension updates).
+    private emit_cached(cg: CodeWriter, key: string, input: { name: string }, emitter: (cg: CodeWriter) => void) {
+        const fingerprint = fingerprint_of([this._fingerprint_salt, key, input, this._types.find_doc(input.name) ?? null]);
+        let lines = this._cache.get(key, fingerprint);
+        if (typeof lines === "undefined") {
+            const capture = new BufferedWriter(this._types);
+            emitter(capture);
+            lines = capture.lines;
+            this._cache.set(key, fingerprint, lines);
+        }
+        for (let line of lines) {
+            cg.line(line);
+        }
+    }
+
+    private close_splitter() {
+        if (this._splitter === undefined) {
+            return;
+        }
+        if (this._splitter.close()) {
+            ++this._written_files;
+        } else {
+            ++this._unchanged_files;
+        }
+        this._splitter = undefined;
     }
 
     private make_path(index: number) {
@@ -1567,9 +1725,7 @@ export class TSDCodeGen {
     }
 
     private new_splitter() {
-        if (this._splitter !== undefined) {
-            this._splitter.close();
-        }
+        this.close_splitter();
         const filename = this.make_path(this._split_index++);
         console.log("new writer", filename);
         this._splitter = new FileSplitter(this._types, filename);
@@ -1629,13 +1785,13 @@ export class TSDCodeGen {
                 // ignore the class if it's already defined as Singleton
                 continue;
             }
-            tasks.add_task("Classes", () => this.emit_godot_class(this.split(), cls, false));
+            tasks.add_task("Classes", () => this.emit_cached(this.split(), `class:${class_name}`, cls, cg => this.emit_godot_class(cg, cls, false)));
         }
 
         // godot primitive types
         for (let class_name in this._types.primitive_types) {
             const cls = this._types.primitive_types[class_name];
-            tasks.add_task("Primitives", () => this.emit_godot_primitive(this.split(), cls));
+            tasks.add_task("Primitives", () => this.emit_cached(this.split(), `primitive:${class_name}`, cls, cg => this.emit_godot_primitive(cg, cls)));
         }
 
         // godot global scope
@@ -1658,8 +1814,10 @@ export class TSDCodeGen {
         }
 
         tasks.add_task("Cleanup", () => {
-            this._splitter?.close();
+            this.close_splitter();
             this.cleanup();
+            this._cache.save();
+            console.log(`godot.d.ts: ${this._written_files} files written, ${this._unchanged_files} files unchanged (cache hits: ${this._cache.hits}, misses: ${this._cache.misses})`);
         });
 
         return tasks.submit();
@@ -1709,7 +1867,7 @@ export class TSDCodeGen {
         const cls = this._types.classes[singleton.class_name];
         if (typeof cls !== "undefined") {
             cg.line_comment_(`_singleton_class_: ${singleton.class_name}`);
-            this.emit_godot_class(cg, cls, true);
+            this.emit_cached(cg, `singleton:${singleton.name}`, cls, cg => this.emit_godot_class(cg, cls, true));
         } else {
             cg.line_comment_(`ERROR: singleton ${singleton.name} without class info ${singleton.class_name}`)
         }
@@ -1891,25 +2049,16 @@ export class SceneTSDCodeGen {
         console.error(`failed to create directory (error: ${dir_error}): ${dir_path}`);
       }
 
-      const file = FileAccess.open(this.make_path(scene_path), FileAccess.ModeFlags.WRITE);
-
-      if (!file) {
-        throw new Error(`failed to open file for writing: ${dir_path}`);
-      }
-
-      try {
-        const file_writer = new FileWriter(this._types, file);
-        const module = new ModuleWriter(file_writer, 'godot');
-        const scene_nodes_interface = new InterfaceWriter(module, 'SceneNodes');
-        const scene_property = scene_nodes_interface.property_(scene_path.replace(/^res:\/\//, ''));
-        this.emit_children_node_types(scene_property, result.children);
-        scene_property.finish();
-        scene_nodes_interface.finish();
-        module.finish();
-        file_writer.finish();
-      } finally {
-        file.close();
-      }
+      const file_writer = new BufferedWriter(this._types);
+      const module = new ModuleWriter(file_writer, 'godot');
+      const scene_nodes_interface = new InterfaceWriter(module, 'SceneNodes');
+      const scene_property = scene_nodes_interface.property_(scene_path.replace(/^res:\/\//, ''));
+      this.emit_children_node_types(scene_property, result.children);
+      scene_property.finish();
+      scene_nodes_interface.finish();
+      module.finish();
+      file_writer.finish();
+      write_file_if_changed(this.make_path(scene_path), file_writer.text);
     } catch (error) {
       console.error(`failed to generate scene node types: ${scene_path}`);
       throw error;
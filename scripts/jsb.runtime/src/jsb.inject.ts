@@ -22,6 +22,7 @@ const proxy_wrap = function(value: any) {
 };
 
 require("godot.typeloader").on_type_loaded("Array", function (type: any) {
+    const container = require("godot-jsb").internal.container;
     proxyable_prototypes.push(type.prototype);
 
     type.prototype[Symbol.iterator] = function* (this: any /* GArray */) {
@@ -30,6 +31,10 @@ require("godot.typeloader").on_type_loaded("Array", function (type: any) {
         }
     };
 
+    type.prototype.toJS = function (this: any) {
+        return container.to_js(this);
+    };
+
     // We're not going to try expose the whole Array API, we'll just be super minimalistic. If the user is after
     // something more complex, it'll likely be more performant to spread the GArray into a JS array anyway.
 
@@ -54,6 +59,9 @@ require("godot.typeloader").on_type_loaded("Array", function (type: any) {
     const toJSON = function(this: any /* GArrayProxy */, key = ""): any {
         return [...this];
     };
+    const toJS = function(this: any /* GArrayProxy */): any {
+        return container.to_js(this[ProxyTarget]);
+    };
     const toString = function(this: any /* GArrayProxy */, index?: number): any {
         return [...this].map(v => v?.toString?.() ?? v).join(",");
     };
@@ -73,24 +81,26 @@ require("godot.typeloader").on_type_loaded("Array", function (type: any) {
             if (!Number.isFinite(num)) {
                 switch (p) {
                     case "length":
-                        return target.size();
+                        return container.size(target);
                     case "push":
                         return push;
                     case "toJSON":
                         return toJSON;
                     case "toString":
                         return toString;
+                    case "toJS":
+                        return toJS;
                 }
 
                 const mapped = method_mapping[p];
                 return mapped && Reflect.get(target, mapped).bind(target);
             }
 
-            if (num < 0 || num >= target.size()) {
+            if (num < 0 || num >= container.size(target)) {
                 return undefined;
             }
 
-            return proxy_wrap(target.get(num));
+            return proxy_wrap(container.get(target, num));
         },
         getOwnPropertyDescriptor(target, p) {
             if (typeof p !== "string") {
@@ -99,14 +109,14 @@ require("godot.typeloader").on_type_loaded("Array", function (type: any) {
 
             const num = Number.parseInt(p);
 
-            if (!(num >= 0) || num >= target.size()) {
+            if (!(num >= 0) || num >= container.size(target)) {
                 return undefined;
             }
 
             return {
                 configurable: true,
                 enumerable: true,
-                value: proxy_wrap(target.get(num)),
+                value: proxy_wrap(container.get(target, num)),
                 writable: true,
             };
         },
@@ -123,22 +133,19 @@ require("godot.typeloader").on_type_loaded("Array", function (type: any) {
                     case "push":
                     case "toJSON":
                     case "toString":
+                    case "toJS":
                         return true;
                 }
                 return !!method_mapping[p];
             }
 
-            return num >= 0 && num < target.size();
+            return num >= 0 && num < container.size(target);
         },
         isExtensible(target) {
             return true;
         },
         ownKeys(target) {
-            const keys: string[] = [];
-            for (let i = 0; i < target.size(); i++) {
-                keys.push(i.toString());
-            }
-            return keys;
+            return container.keys(target);
         },
         preventExtensions(target) {
             return true;
@@ -150,12 +157,7 @@ require("godot.typeloader").on_type_loaded("Array", function (type: any) {
 
             const num = Number.parseInt(p);
 
-            if (!(num >= 0) || num >= target.size()) {
-                return false;
-            }
-
-            target.set(num, proxy_unwrap(newValue));
-            return true;
+            return container.set(target, num, proxy_unwrap(newValue));
         },
         setPrototypeOf(target, v) {
             return false;
@@ -168,6 +170,7 @@ require("godot.typeloader").on_type_loaded("Array", function (type: any) {
 });
 
 require("godot.typeloader").on_type_loaded("Dictionary", function (type: any) {
+    const container = require("godot-jsb").internal.container;
     proxyable_prototypes.push(type.prototype);
 
     type.prototype[Symbol.iterator] = function* () {
@@ -179,12 +182,19 @@ require("godot.typeloader").on_type_loaded("Dictionary", function (type: any) {
         }
     };
 
+    type.prototype.toJS = function (this: any) {
+        return container.to_js(this);
+    };
+    const toJS = function (this: any /* GDictionaryProxy */) {
+        return container.to_js(this[ProxyTarget]);
+    };
+
     const handler: ProxyHandler<any> = {
         defineProperty(target, property, attributes) {
             return false;
         },
         deleteProperty(target, p) {
-            return target.erase(p);
+            return container.erase(target, p);
         },
         get(target, p, receiver) {
             if (typeof p !== "string") {
@@ -193,13 +203,13 @@ require("godot.typeloader").on_type_loaded("Dictionary", function (type: any) {
                     : undefined;
             }
 
-            const value = target.get(p);
-            return value !== null
+            const value = container.get(target, p);
+            return value !== undefined
                 ? proxy_wrap(value)
-                : target.has(p)
-                    ? value
-                    : p === "toString"
-                        ? Object.prototype.toString
+                : p === "toString"
+                    ? Object.prototype.toString
+                    : p === "toJS"
+                        ? toJS
                         : undefined;
         },
         getOwnPropertyDescriptor(target, p) {
@@ -210,7 +220,7 @@ require("godot.typeloader").on_type_loaded("Dictionary", function (type: any) {
             return {
                 configurable: true,
                 enumerable: true,
-                value: proxy_wrap(target.get(p)),
+                value: proxy_wrap(container.get(target, p)),
                 writable: true,
             };
         },
@@ -219,19 +229,13 @@ require("godot.typeloader").on_type_loaded("Dictionary", function (type: any) {
                 return false;
             }
 
-            return target.has(p) || p === "toString";
+            return container.has(target, p) || p === "toString" || p === "toJS";
         },
         isExtensible(target) {
             return true;
         },
         ownKeys(target) {
-            const keys: string[] = [];
-            for (const key of target.keys()) {
-                if (typeof key === "string") {
-                    keys.push(key);
-                }
-            }
-            return keys;
+            return container.keys(target);
         },
         preventExtensions(target) {
             return false;
@@ -240,8 +244,7 @@ require("godot.typeloader").on_type_loaded("Dictionary", function (type: any) {
             if (typeof p !== "string") {
                 return false;
             }
-            target.set(p, proxy_unwrap(newValue));
-            return true;
+            return container.set(target, p, proxy_unwrap(newValue));
         },
         setPrototypeOf(target, v) {
             return false;
@@ -276,6 +279,9 @@ require("godot.typeloader").on_type_loaded("Callable", function (type: any) {
 });
 
 require("godot.typeloader").on_type_loaded("Signal", function (type: any) {
+    // connected javascript functions are called without translating the arguments into Variants
+    type.prototype.emit = require("godot-jsb").internal.emit_signal;
+
     type.prototype.as_promise = function () {
         let self = this;
         return new Promise(function (resolve, reject) {
@@ -41,7 +41,18 @@ declare module "jsb.editor.codegen" {
         private _outDir;
         private _splitter;
         private _types;
-        constructor(outDir: string);
+        private _cache;
+        private _fingerprint_salt;
+        private _written_files;
+        private _unchanged_files;
+        /**
+         * @param outDir the directory of the generated d.ts files
+         * @param cachePath the generated code of classes is cached in this file for the next run (no cache if not specified)
+         */
+        constructor(outDir: string, cachePath?: string);
+        private make_fingerprint_salt;
+        private emit_cached;
+        private close_splitter;
         private make_path;
         private new_splitter;
         private split;
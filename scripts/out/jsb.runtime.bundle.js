@@ -768,12 +768,16 @@ const proxy_wrap = function (value) {
         : value;
 };
 require("godot.typeloader").on_type_loaded("Array", function (type) {
+    const container = require("godot-jsb").internal.container;
     proxyable_prototypes.push(type.prototype);
     type.prototype[Symbol.iterator] = function* () {
         for (let i = 0; i < this.size(); ++i) {
             yield this.get_indexed(i);
         }
     };
+    type.prototype.toJS = function () {
+        return container.to_js(this);
+    };
     // We're not going to try expose the whole Array API, we'll just be super minimalistic. If the user is after
     // something more complex, it'll likely be more performant to spread the GArray into a JS array anyway.
     const method_mapping = {
@@ -796,6 +800,9 @@ require("godot.typeloader").on_type_loaded("Array", function (type) {
     const toJSON = function (key = "") {
         return [...this];
     };
+    const toJS = function () {
+        return container.to_js(this[ProxyTarget]);
+    };
     const toString = function (index) {
         return [...this].map(v => { var _a, _b; return (_b = (_a = v === null || v === void 0 ? void 0 : v.toString) === null || _a === void 0 ? void 0 : _a.call(v)) !== null && _b !== void 0 ? _b : v; }).join(",");
     };
@@ -812,34 +819,36 @@ require("godot.typeloader").on_type_loaded("Array", function (type) {
             if (!Number.isFinite(num)) {
                 switch (p) {
                     case "length":
-                        return target.size();
+                        return container.size(target);
                     case "push":
                         return push;
                     case "toJSON":
                         return toJSON;
                     case "toString":
                         return toString;
+                    case "toJS":
+                        return toJS;
                 }
                 const mapped = method_mapping[p];
                 return mapped && Reflect.get(target, mapped).bind(target);
             }
-            if (num < 0 || num >= target.size()) {
+            if (num < 0 || num >= container.size(target)) {
                 return undefined;
             }
-            return proxy_wrap(target.get(num));
+            return proxy_wrap(container.get(target, num));
         },
         getOwnPropertyDescriptor(target, p) {
             if (typeof p !== "string") {
                 return undefined;
             }
             const num = Number.parseInt(p);
-            if (!(num >= 0) || num >= target.size()) {
+            if (!(num >= 0) || num >= container.size(target)) {
                 return undefined;
             }
             return {
                 configurable: true,
                 enumerable: true,
-                value: proxy_wrap(target.get(num)),
+                value: proxy_wrap(container.get(target, num)),
                 writable: true,
             };
         },
@@ -854,21 +863,18 @@ require("godot.typeloader").on_type_loaded("Array", function (type) {
                     case "push":
                     case "toJSON":
                     case "toString":
+                    case "toJS":
                         return true;
                 }
                 return !!method_mapping[p];
             }
-            return num >= 0 && num < target.size();
+            return num >= 0 && num < container.size(target);
         },
         isExtensible(target) {
             return true;
         },
         ownKeys(target) {
-            const keys = [];
-            for (let i = 0; i < target.size(); i++) {
-                keys.push(i.toString());
-            }
-            return keys;
+            return container.keys(target);
         },
         preventExtensions(target) {
             return true;
@@ -878,11 +884,7 @@ require("godot.typeloader").on_type_loaded("Array", function (type) {
                 return false;
             }
             const num = Number.parseInt(p);
-            if (!(num >= 0) || num >= target.size()) {
-                return false;
-            }
-            target.set(num, proxy_unwrap(newValue));
-            return true;
+            return container.set(target, num, proxy_unwrap(newValue));
         },
         setPrototypeOf(target, v) {
             return false;
@@ -893,6 +895,7 @@ require("godot.typeloader").on_type_loaded("Array", function (type) {
     };
 });
 require("godot.typeloader").on_type_loaded("Dictionary", function (type) {
+    const container = require("godot-jsb").internal.container;
     proxyable_prototypes.push(type.prototype);
     type.prototype[Symbol.iterator] = function* () {
         let self = this;
@@ -902,12 +905,18 @@ require("godot.typeloader").on_type_loaded("Dictionary", function (type) {
             yield { key: key, value: self.get_keyed(key) };
         }
     };
+    type.prototype.toJS = function () {
+        return container.to_js(this);
+    };
+    const toJS = function () {
+        return container.to_js(this[ProxyTarget]);
+    };
     const handler = {
         defineProperty(target, property, attributes) {
             return false;
         },
         deleteProperty(target, p) {
-            return target.erase(p);
+            return container.erase(target, p);
         },
         get(target, p, receiver) {
             if (typeof p !== "string") {
@@ -915,13 +924,13 @@ require("godot.typeloader").on_type_loaded("Dictionary", function (type) {
                     ? target
                     : undefined;
             }
-            const value = target.get(p);
-            return value !== null
+            const value = container.get(target, p);
+            return value !== undefined
                 ? proxy_wrap(value)
-                : target.has(p)
-                    ? value
-                    : p === "toString"
-                        ? Object.prototype.toString
+                : p === "toString"
+                    ? Object.prototype.toString
+                    : p === "toJS"
+                        ? toJS
                         : undefined;
         },
         getOwnPropertyDescriptor(target, p) {
@@ -931,7 +940,7 @@ require("godot.typeloader").on_type_loaded("Dictionary", function (type) {
             return {
                 configurable: true,
                 enumerable: true,
-                value: proxy_wrap(target.get(p)),
+                value: proxy_wrap(container.get(target, p)),
                 writable: true,
             };
         },
@@ -939,19 +948,13 @@ require("godot.typeloader").on_type_loaded("Dictionary", function (type) {
             if (typeof p !== "string") {
                 return false;
             }
-            return target.has(p) || p === "toString";
+            return container.has(target, p) || p === "toString" || p === "toJS";
         },
         isExtensible(target) {
             return true;
         },
         ownKeys(target) {
-            const keys = [];
-            for (const key of target.keys()) {
-                if (typeof key === "string") {
-                    keys.push(key);
-                }
-            }
-            return keys;
+            return container.keys(target);
         },
         preventExtensions(target) {
             return false;
@@ -960,8 +963,7 @@ require("godot.typeloader").on_type_loaded("Dictionary", function (type) {
             if (typeof p !== "string") {
                 return false;
             }
-            target.set(p, proxy_unwrap(newValue));
-            return true;
+            return container.set(target, p, proxy_unwrap(newValue));
         },
         setPrototypeOf(target, v) {
             return false;
@@ -992,6 +994,8 @@ require("godot.typeloader").on_type_loaded("Callable", function (type) {
     };
 });
 require("godot.typeloader").on_type_loaded("Signal", function (type) {
+    // connected javascript functions are called without translating the arguments into Variants
+    type.prototype.emit = require("godot-jsb").internal.emit_signal;
     type.prototype.as_promise = function () {
         let self = this;
         return new Promise(function (resolve, reject) {
@@ -23,7 +23,7 @@ declare module "godot" {
     }
 
     // singleton
-    namespace Engine { function get_time_scale(): number; }
+    namespace Engine { function get_time_scale(): number; function get_version_info(): GDictionary; }
 
     namespace MultiplayerAPI {
         enum RPCMode {
@@ -78,8 +78,10 @@ declare module "godot" {
 
         static open(path: string, flags: number);
         static file_exists(path: string): boolean;
+        static get_file_as_string(path: string): string;
 
         store_line(str: string);
+        store_string(str: string);
         get_position(): number;
         flush(): void;
         close() : void;
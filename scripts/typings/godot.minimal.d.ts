@@ -1,6 +1,6 @@
 
 declare module "godot-jsb" {
-    import { Object as GDObject, PackedByteArray, PropertyUsageFlags, PropertyHint, MethodFlags, Variant, Callable0, Callable1, Callable2, Callable3, Callable4, Callable5, StringName, MultiplayerAPI, MultiplayerPeer } from "godot";
+    import { Object as GDObject, PackedByteArray, PropertyUsageFlags, PropertyHint, MethodFlags, Variant, Callable0, Callable1, Callable2, Callable3, Callable4, Callable5, StringName, MultiplayerAPI, MultiplayerPeer, GArray, GDictionary, Signal } from "godot";
 
     const DEV_ENABLED: boolean;
     const TOOLS_ENABLED: boolean;
@@ -79,6 +79,50 @@ declare module "godot-jsb" {
      */
     function to_array_buffer(packed: PackedByteArray): ArrayBuffer;
 
+    /**
+     * Read the sources of modules in background ahead of demand (e.g. the scripts of an upcoming scene),
+     * then `require` of them is a memory lookup. Only the given modules are read, not their dependencies.
+     * @returns num of modules queued (the ones already loaded are skipped)
+     */
+    function prefetch(...module_ids: string[]): number;
+
+    /**
+     * Call profiler for script calls (engine to JS), native calls (JS to engine) and module loads.
+     * It's also available in release builds, and only usable on the main thread.
+     */
+    namespace profiler {
+        /** Start a new trace session (events of the previous session are discarded) */
+        function start(): void;
+
+        /** Stop the current trace session */
+        function stop(): void;
+
+        /**
+         * Save the events of the last (or current) trace session in Chrome Trace Event Format,
+         * which could be opened with chrome://tracing, Perfetto or Speedscope.
+         * @returns true if saved successfully
+         */
+        function save(path: string): boolean;
+    }
+
+    /**
+     * Memory budget of the current environment (see project settings `runtime/memory/*`, and the options of `JSWorker`).
+     * NOTE: only the QuickJS runtime enforces the hard limit on allocations, other runtimes check it periodically.
+     */
+    namespace memory {
+        type PressureLevel = "none" | "moderate" | "critical" | "exceeded";
+
+        /** Limits are zero if unlimited */
+        function get_usage(): { used: number, soft_limit: number, hard_limit: number, level: PressureLevel };
+
+        /**
+         * Set the callback invoked when the memory pressure level changes.
+         * A GC runs automatically before raising the `critical` level (the soft limit reached).
+         * Workers are terminated on the `exceeded` level without the callback invoked, the error is reported to `JSWorker.onerror` instead.
+         */
+        function set_pressure_callback(callback: ((level: PressureLevel, used: number) => void) | null): void;
+    }
+
     interface ScriptPropertyInfo {
         name: string;
         type: Variant.Type;
@@ -116,6 +160,28 @@ declare module "godot-jsb" {
          * Get the transformed type name of a Variant.Type
          */
         function get_type_name(type: Variant.Type): StringName;
+
+        /**
+         * Emit a signal, installed as `Signal.prototype.emit`
+         */
+        function emit_signal(this: Signal, ...args: any[]): void;
+
+        /**
+         * Element access of GArray/GDictionary on the underlying storage (used by the proxies)
+         */
+        namespace container {
+            function size(target: GArray | GDictionary): number;
+            /** undefined if the index is out of range, or the key does not exist */
+            function get(target: GArray | GDictionary, key: any): any;
+            /** array elements can only be replaced, false if the index is out of range */
+            function set(target: GArray | GDictionary, key: any, value: any): boolean;
+            function has(target: GArray | GDictionary, key: any): boolean;
+            function erase(target: GDictionary, key: any): boolean;
+            /** the indices of an array, or the string keys of a dictionary */
+            function keys(target: GArray | GDictionary): string[];
+            /** a shallow snapshot as a JS array or a plain object */
+            function to_js(target: GArray | GDictionary): any;
+        }
     }
 
     namespace editor {
@@ -235,6 +235,11 @@ declare module "godot" {
          */
         includes(searchElement: T): boolean;
         toJSON(key?: any): any;
+        /**
+         * Returns a JavaScript array with a snapshot of the elements, converted in a single native call.
+         * Nested GArray/GDictionary elements are not converted.
+         */
+        toJS(): T[];
         toString(): string;
         [n: number]: T | GProxyValueWrap<T>; // More accurate get type blocked by https://github.com/microsoft/TypeScript/issues/43826
     }
@@ -247,6 +252,12 @@ declare module "godot" {
         [K in keyof T & string]: T[K] | GProxyValueWrap<T[K]>; // More accurate get type blocked by https://github.com/microsoft/TypeScript/issues/43826
     } & ('toString' extends keyof T ? {} : {
         toString(): string;
+    }) & ('toJS' extends keyof T ? {} : {
+        /**
+         * Returns a plain JavaScript object with a snapshot of the entries, converted in a single native call.
+         * Nested GArray/GDictionary values are not converted.
+         */
+        toJS(): T;
     });
 
     type GProxyValueWrap<V> = V extends GArray<infer E>
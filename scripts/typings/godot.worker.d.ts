@@ -3,7 +3,10 @@ declare module "godot.worker" {
     import { Object as GDObject } from "godot";
 
     class JSWorker {
-        constructor(path: string);
+        /**
+         * @param options memory limits in bytes, default values are read from the project settings `runtime/memory/worker_*`
+         */
+        constructor(path: string, options?: { softMemoryLimit?: number, hardMemoryLimit?: number });
 
         postMessage(message: any): void;
         terminate(): void;
@@ -11,7 +14,7 @@ declare module "godot.worker" {
         onready?: () => void;
         onmessage?: (message: any) => void;
 
-        //TODO not implemented yet
+        // called if the worker is terminated due to errors (e.g. the hard memory limit exceeded)
         onerror?: (error: any) => void;
 
         ontransfer?: (obj: GDObject) => void;
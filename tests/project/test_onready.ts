@@ -0,0 +1,18 @@
+import { Node } from "godot"
+import { onready } from "godot.annotations"
+
+export default class TestOnReady extends Node {
+    @onready("A")
+    a!: Node;
+
+    // not in the tree, assigned with null without aborting the following fields
+    @onready("Missing")
+    missing!: Node | null;
+
+    @onready("A/B")
+    b!: Node;
+
+    summary(): string {
+        return [this.a?.get_name(), this.missing, this.b?.get_name()].join(",");
+    }
+}
@@ -4,6 +4,12 @@
 #include "jsb_test_helpers.h"
 #include "../bridge/jsb_essentials.h"
 #include "../bridge/jsb_type_convert.h"
+#include "../bridge/jsb_bootstrap_cache.h"
+#include "../bridge/jsb_json_module_cache.h"
+#include "../bridge/jsb_object_binding_metadata.h"
+#include "../internal/jsb_settings.h"
+#include "../internal/jsb_path_util.h"
+#include "../internal/jsb_global_class_index.h"
 
 #define JSB_TESTS_OPTION_ENABLED(OptionName) kOption_##OptionName
 #define JSB_TESTS_OPTION_DEFINE(OptionName, IsEnabled) enum { kOption_##OptionName = IsEnabled };
@@ -250,6 +256,326 @@ return 1+1;
         isolate->Dispose();
     }
 
+    TEST_CASE("[jsb] SourceMap")
+    {
+        internal::SourceMap map;
+        const char mappings[] = ";;;AAAA,iCAA6B;AAC7B,MAAa,QAAQ;CAAI";
+        CHECK(map.parse_mappings(mappings, sizeof(mappings) - 1));
+        CHECK(map.get_line_count() == 6);
+        CHECK(map.get_decoded_line_count() == 0);
+
+        internal::IndexedSourcePosition pos;
+        CHECK(!map.find(1, 0, pos));
+        CHECK(map.get_decoded_line_count() == 2);
+        CHECK(map.find(3, 40, pos));
+        CHECK(pos.line == 0);
+        CHECK(pos.column == 29);
+        CHECK(map.get_decoded_line_count() == 4);
+        // the second segment of the line (generated columns 6..13)
+        CHECK(map.find(4, 10, pos));
+        CHECK(pos.line == 1);
+        CHECK(pos.column == 13);
+        // the third segment (starts at generated column 14)
+        CHECK(map.find(4, 14, pos));
+        CHECK(pos.line == 1);
+        CHECK(pos.column == 21);
+        CHECK(map.find(5, 0, pos));
+        CHECK(pos.line == 1);
+        CHECK(pos.column == 25);
+        // out of range lines fall back to the last mapped line
+        CHECK(map.find(100, 0, pos));
+        CHECK(pos.column == 25);
+    }
+
+    TEST_CASE("[jsb] GlobalClassIndex parse")
+    {
+        typedef internal::GlobalClassIndex GlobalClassIndex;
+        internal::GlobalClassInfo info;
+
+        // typescript
+        CHECK(GlobalClassIndex::parse(R"--(
+import { Node } from "godot";
+// export default class Fake extends Node
+const s = "export default class Fake2 extends Node";
+@tool()
+@icon("res://icon.svg")
+export default class MyNode extends Node {
+    @export(Variant.Type.TYPE_INT)
+    value = 1;
+}
+)--", false, info));
+        CHECK(info.class_name == "MyNode");
+        CHECK(info.base_type == "Node");
+        CHECK(info.icon_path == "res://icon.svg");
+        CHECK(info.is_tool);
+
+        info = {};
+        CHECK(GlobalClassIndex::parse("export default class Other extends godot.Sprite2D {}", false, info));
+        CHECK(info.class_name == "Other");
+        CHECK(info.base_type == "Sprite2D");
+        CHECK(!info.is_tool);
+
+        // decorators are not carried over to the following declarations
+        info = {};
+        CHECK(GlobalClassIndex::parse("@tool() class A {} /* comment */ export default class B extends Node {}", false, info));
+        CHECK(info.class_name == "B");
+        CHECK(!info.is_tool);
+
+        // javascript (compiled by tsc)
+        info = {};
+        CHECK(GlobalClassIndex::parse(R"--(
+"use strict";
+Object.defineProperty(exports, "__esModule", { value: true });
+exports.default = void 0;
+const godot_1 = require("godot");
+const re = /class Fake extends Node/g;
+let MyNode = class MyNode extends godot_1.Node {
+};
+MyNode = __decorate([(0, godot_annotations_1.tool)()], MyNode);
+exports.default = MyNode;
+)--", true, info));
+        CHECK(info.class_name == "MyNode");
+        CHECK(info.base_type == "Node");
+
+        info = {};
+        CHECK(GlobalClassIndex::parse("exports.default = class Another extends Node2D { }", true, info));
+        CHECK(info.class_name == "Another");
+        CHECK(info.base_type == "Node2D");
+
+        info = {};
+        CHECK(!GlobalClassIndex::parse("exports.default = helper;", true, info));
+    }
+
+    TEST_CASE("[jsb] GlobalClassIndex")
+    {
+        const String script_path = "./.godot/global_class_index_test.ts";
+        const String index_path = "./.godot/global_class_index_test.bin";
+        {
+            const Ref<FileAccess> f = FileAccess::open(script_path, FileAccess::WRITE);
+            REQUIRE(f.is_valid());
+            f->store_string("export default class IndexedNode extends Node {}");
+        }
+
+        internal::GlobalClassInfo info;
+        {
+            internal::GlobalClassIndex index;
+            CHECK(index.get(script_path, info));
+            CHECK(info.class_name == "IndexedNode");
+            CHECK(index.get_stats().parsed == 1);
+
+            // unchanged, but modified just now (within the resolution of the modified time), so it's hashed again
+            CHECK(index.get(script_path, info));
+            CHECK(info.class_name == "IndexedNode");
+            CHECK(index.get_stats().parsed == 1);
+            CHECK(index.get_stats().hash_hits == 1);
+
+            // changed in the same second
+            {
+                const Ref<FileAccess> f = FileAccess::open(script_path, FileAccess::WRITE);
+                REQUIRE(f.is_valid());
+                f->store_string("export default class RenamedNode extends Node {}");
+            }
+            CHECK(index.get(script_path, info));
+            CHECK(info.class_name == "RenamedNode");
+            CHECK(index.get_stats().parsed == 2);
+
+            CHECK(!index.get("./.godot/global_class_index_missing.ts", info));
+            CHECK(index.is_dirty());
+            CHECK(index.save(index_path) == OK);
+            CHECK(!index.is_dirty());
+        }
+
+        // persisted
+        {
+            internal::GlobalClassIndex index;
+            CHECK(index.load(index_path) == OK);
+            CHECK(index.get_stats().entries == 1);
+            info = {};
+            CHECK(index.get(script_path, info));
+            CHECK(info.class_name == "RenamedNode");
+            CHECK(info.base_type == "Node");
+            CHECK(index.get_stats().parsed == 0);
+
+            // the entries of the deleted files are dropped on saving
+            CHECK(DirAccess::remove_absolute(script_path) == OK);
+            index.clear();
+            CHECK(index.load(index_path) == OK);
+            CHECK(index.get_stats().entries == 1);
+            CHECK(index.save(index_path) == OK);
+            CHECK(index.get_stats().entries == 0);
+        }
+        CHECK(DirAccess::remove_absolute(index_path) == OK);
+    }
+
+    TEST_CASE("[jsb] LogQueue")
+    {
+        // capacity is rounded up to 16 at least
+        internal::LogQueue queue(4, 0);
+        CHECK(queue.is_empty());
+        for (int i = 0; i < 20; ++i)
+        {
+            internal::LogEntry entry;
+            entry.severity = internal::ELogSeverity::Verbose;
+            entry.text = jsb_format("[LogQueue] %d", i);
+            queue.push(std::move(entry));
+        }
+        CHECK(!queue.is_empty());
+        CHECK(queue.get_stats().pushed == 16);
+        CHECK(queue.get_stats().dropped == 4);
+        CHECK(queue.drain() == 16);
+        CHECK(queue.is_empty());
+        CHECK(queue.drain() == 0);
+
+        // rate limited (per severity)
+        internal::LogQueue limited_queue(16, 2);
+        for (int i = 0; i < 4; ++i)
+        {
+            internal::LogEntry entry;
+            entry.severity = i < 3 ? internal::ELogSeverity::Verbose : internal::ELogSeverity::Debug;
+            entry.text = "[LogQueue] rate limited";
+            limited_queue.push(std::move(entry));
+        }
+        CHECK(limited_queue.get_stats().pushed == 3);
+        CHECK(limited_queue.get_stats().rate_limited == 1);
+
+        // warnings are not limited by default, and never starved by the flood of other levels
+        for (int i = 0; i < 3; ++i)
+        {
+            internal::LogEntry entry;
+            entry.severity = internal::ELogSeverity::Warning;
+            entry.text = "[LogQueue] warning";
+            limited_queue.push(std::move(entry));
+        }
+        CHECK(limited_queue.get_stats().pushed == 6);
+        limited_queue.set_rate_limit(internal::ELogSeverity::Warning, 1);
+        for (int i = 0; i < 2; ++i)
+        {
+            internal::LogEntry entry;
+            entry.severity = internal::ELogSeverity::Warning;
+            entry.text = "[LogQueue] warning";
+            limited_queue.push(std::move(entry));
+        }
+        CHECK(limited_queue.get_stats().pushed == 7);
+        CHECK(limited_queue.get_stats().rate_limited == 2);
+        CHECK(limited_queue.try_drain() == 7);
+
+        // raw frames are resolved only when emitted
+        internal::LogEntry entry;
+        entry.text = "[LogQueue] trace";
+        entry.frames.resize(2);
+        entry.frames.write[0] = { "foo", "res://a.js", 3, 4 };
+        entry.frames.write[1] = { String(), "res://b.js", 5, 0 };
+        entry.with_stacktrace = true;
+        entry.resolve(nullptr);
+        CHECK(entry.frames.is_empty());
+        CHECK(entry.position.filename == "res://a.js");
+        CHECK(entry.position.line == 3);
+        CHECK(entry.text == "[LogQueue] trace\n    at foo (res://a.js:3:4)\n    at res://b.js:5");
+    }
+
+    TEST_CASE("[jsb] ArrayBufferAllocator")
+    {
+        ArrayBufferAllocator allocator(ArrayBufferAllocator::kMaxClassSize * 2);
+
+        // recycled in the same size class
+        void* p1 = allocator.Allocate(1000);
+        CHECK(allocator.get_stats().outstanding_bytes == 1000);
+        allocator.Free(p1, 1000);
+        CHECK(allocator.get_stats().outstanding_bytes == 0);
+        CHECK(allocator.get_stats().pooled_bytes == 1024);
+        void* p2 = allocator.Allocate(600);
+        CHECK(p2 == p1);
+        CHECK(allocator.get_stats().pool_hits == 1);
+        CHECK(allocator.get_stats().pooled_bytes == 0);
+
+        // zeroed for the requested length even if recycled
+        memset(p2, 0xff, 600);
+        allocator.Free(p2, 600);
+        const uint8_t* p3 = (const uint8_t*) allocator.Allocate(700);
+        bool zeroed = true;
+        for (int i = 0; i < 700; ++i) zeroed = zeroed && p3[i] == 0;
+        CHECK(zeroed);
+        allocator.Free((void*) p3, 700);
+
+        // large buffers are not pooled
+        void* large = allocator.AllocateUninitialized(ArrayBufferAllocator::kMaxClassSize + 1);
+        allocator.Free(large, ArrayBufferAllocator::kMaxClassSize + 1);
+        CHECK(allocator.get_stats().pooled_bytes == 1024);
+
+        // capped by the pool limit
+        void* b1 = allocator.AllocateUninitialized(ArrayBufferAllocator::kMaxClassSize);
+        void* b2 = allocator.AllocateUninitialized(ArrayBufferAllocator::kMaxClassSize);
+        allocator.Free(b1, ArrayBufferAllocator::kMaxClassSize);
+        allocator.Free(b2, ArrayBufferAllocator::kMaxClassSize);
+        CHECK(allocator.get_stats().pooled_bytes == 1024 + ArrayBufferAllocator::kMaxClassSize);
+
+        allocator.set_pool_limit(0);
+        CHECK(allocator.get_stats().pooled_bytes == 0);
+        CHECK(allocator.get_stats().outstanding_bytes == 0);
+    }
+
+    TEST_CASE("[jsb] MemoryBudget")
+    {
+        MemoryBudget budget;
+        CHECK(!budget.is_limited());
+        CHECK(budget.get_level(UINT64_MAX) == MemoryPressureLevel::None);
+
+        budget.soft_limit = 1000;
+        budget.hard_limit = 2000;
+        CHECK(budget.is_limited());
+        CHECK(budget.get_level(0) == MemoryPressureLevel::None);
+        CHECK(budget.get_level(1000 / 100 * JSB_MEMORY_PRESSURE_MODERATE_PERCENT - 1) == MemoryPressureLevel::None);
+        CHECK(budget.get_level(1000 / 100 * JSB_MEMORY_PRESSURE_MODERATE_PERCENT) == MemoryPressureLevel::Moderate);
+        CHECK(budget.get_level(1000) == MemoryPressureLevel::Critical);
+        CHECK(budget.get_level(2000) == MemoryPressureLevel::Exceeded);
+
+        // hard limit only
+        budget.soft_limit = 0;
+        CHECK(budget.get_level(1999) == MemoryPressureLevel::None);
+        CHECK(budget.get_level(2000) == MemoryPressureLevel::Exceeded);
+    }
+
+    TEST_CASE("[jsb] CallProfiler")
+    {
+        typedef internal::CallProfiler CallProfiler;
+        const StringName source = "res://test.js";
+        const StringName class_name = "TestClass";
+        const StringName method_name = "test_method";
+
+        std::vector<CallProfiler::Event> events;
+        CallProfiler::collect(events);
+        events.clear();
+
+        // nothing recorded if not enabled
+        {
+            JSB_CALL_PROFILER_SCOPE(ScriptCall, source, class_name, method_name);
+        }
+        CallProfiler::collect(events);
+        CHECK(events.empty());
+
+        CallProfiler::start_trace();
+        CHECK(CallProfiler::is_enabled());
+        {
+            JSB_CALL_PROFILER_SCOPE(ScriptCall, source, class_name, method_name);
+            JSB_CALL_PROFILER_SCOPE(ModuleLoad, source, CallProfiler::empty_name(), CallProfiler::empty_name());
+        }
+        CallProfiler::collect(events);
+        CallProfiler::stop_trace();
+        CHECK(!CallProfiler::is_enabled());
+
+        // scopes are destructed in reverse order
+        REQUIRE(events.size() == 2);
+        CHECK(events[0].kind == CallProfiler::ModuleLoad);
+        CHECK(events[1].kind == CallProfiler::ScriptCall);
+        CHECK(events[1].name == method_name);
+        CHECK(events[1].begin_usec <= events[0].begin_usec);
+
+        const String json = CallProfiler::get_trace_json();
+        CHECK(json.contains("\"name\":\"TestClass.test_method\""));
+        CHECK(json.contains("\"cat\":\"module\""));
+        CHECK(JSON::parse_string(json).get_type() == Variant::DICTIONARY);
+    }
+
     TEST_CASE("[jsb] StringNameCache")
     {
         GodotJSScriptLanguageIniter initer;
@@ -269,6 +595,175 @@ return 1+1;
         env.reset();
     }
 
+    struct ShadowEnvironmentUser
+    {
+        bool is_shadow = false;
+        bool is_valid = false;
+
+        // evaluated in the shadow environment if not empty
+        String source;
+        Variant result;
+
+        // shadow environments are only used on the threads without an environment
+        static void run(void* p_data)
+        {
+            ShadowEnvironmentUser* self = (ShadowEnvironmentUser*) p_data;
+            JSEnvironment env("shadow_environment_test", true);
+            self->is_shadow = env.is_shadow();
+            self->is_valid = env->get_isolate() != nullptr;
+            if (!self->source.is_empty())
+            {
+                const CharString source = self->source.utf8();
+                Error err;
+                self->result = env->eval_source(source.get_data(), source.length(), "shadow_environment_test.js", err).to_variant();
+                CHECK(err == OK);
+            }
+        }
+    };
+
+#if JSB_STRING_VALUE_CACHE_SIZE
+    TEST_CASE("[jsb] StringValueCache")
+    {
+        GodotJSScriptLanguageIniter initer;
+
+        std::shared_ptr<jsb::Environment> env = GodotJSScriptLanguage::get_singleton()->get_environment();
+        {
+            JSB_TESTS_EXECUTION_SCOPE(env.get());
+            v8::Isolate* isolate = env->get_isolate();
+            StringValueCache cache;
+
+            // same content, same JS string
+            const v8::Local<v8::String> idle = cache.get_string_value(isolate, "idle");
+            CHECK(cache.get_string_value(isolate, "idle") == idle);
+            CHECK(cache.get_stats().hits == 1);
+            CHECK(cache.get_stats().misses == 1);
+            CHECK(cache.get_stats().entries == 1);
+
+            // back to String by identity
+            CHECK(cache.get_string(isolate, idle) == "idle");
+            CHECK(cache.get_stats().hits == 2);
+
+            // a JS string converted to String is reused in the other direction
+            const v8::Local<v8::String> walk = impl::Helper::new_string(isolate, "walk");
+            CHECK(cache.get_string(isolate, walk) == "walk");
+            CHECK(cache.get_string_value(isolate, "walk") == walk);
+            CHECK(cache.get_stats().entries == 2);
+
+            // long strings are not cached
+            const String long_str = String("x").repeat(JSB_STRING_VALUE_CACHE_MAX_LENGTH + 1);
+            CHECK(cache.get_string_value(isolate, long_str) != cache.get_string_value(isolate, long_str));
+            CHECK(cache.get_stats().entries == 2);
+
+            cache.clear();
+            CHECK(cache.get_stats().entries == 0);
+            CHECK(cache.get_string_value(isolate, "idle") != idle);
+            cache.clear();
+        }
+    }
+#endif
+
+    TEST_CASE("[jsb] String conversion")
+    {
+        GodotJSScriptLanguageIniter initer;
+
+        std::shared_ptr<jsb::Environment> env = GodotJSScriptLanguage::get_singleton()->get_environment();
+        {
+            JSB_TESTS_EXECUTION_SCOPE(env.get());
+            v8::Isolate* isolate = env->get_isolate();
+            const v8::Local<v8::Context> context = env->get_context();
+            GodotJSScriptLanguage* lang = GodotJSScriptLanguage::get_singleton();
+            Error err;
+
+            // ascii, latin1 (narrow strings in QuickJS), BMP, and supplementary planes (surrogate pairs in UTF-16)
+            const String samples[] = { String(), U"ascii", U"caf\u00e9 \u00ff", U"\u4e2d\u6587 mixed", U"\U0001F600 smile \U00010000\U0010FFFF" };
+            const int utf16_lengths[] = { 0, 5, 6, 8, 13 };
+            for (int i = 0; i < (int) std::size(samples); ++i)
+            {
+                const v8::Local<v8::String> value = impl::Helper::new_string(isolate, samples[i]);
+                CHECK(impl::Helper::to_string(isolate, value) == samples[i]);
+                context->Global()->Set(context, impl::Helper::new_string(isolate, "__jsb_str"), value).Check();
+                CHECK((int) lang->eval_source("__jsb_str.length", err).to_variant() == utf16_lengths[i]);
+            }
+
+            // code points above U+FFFF are split into surrogate pairs
+            CHECK((bool) lang->eval_source("__jsb_str.charCodeAt(0) == 0xd83d && __jsb_str.charCodeAt(1) == 0xde00", err).to_variant());
+            CHECK((bool) lang->eval_source("__jsb_str.codePointAt(0) == 0x1f600 && __jsb_str.codePointAt(__jsb_str.length - 2) == 0x10ffff", err).to_variant());
+
+            // and joined back from JS strings
+            const String joined = lang->eval_source("'\\u{1F600}\\u00e9\\ud800\\udc00'", err).to_variant();
+            CHECK(joined.length() == 3);
+            CHECK(joined[0] == 0x1f600);
+            CHECK(joined[1] == 0xe9);
+            CHECK(joined[2] == 0x10000);
+
+#if JSB_WITH_QUICKJS && !JSB_PREFER_QUICKJS_NG
+            // not representable in UTF-16, replaced with U+FFFD.
+            // written to the buffer directly, since the String constructors reject it.
+            String invalid;
+            invalid.resize(3);
+            invalid.ptrw()[0] = 'a';
+            invalid.ptrw()[1] = 0x110000;
+            invalid.ptrw()[2] = 0;
+            const v8::Local<v8::String> replaced = impl::Helper::new_string(isolate, invalid);
+            CHECK(impl::Helper::to_string(isolate, replaced) == String(U"a\ufffd"));
+#endif
+            lang->eval_source("delete globalThis.__jsb_str;", err).ignore();
+        }
+    }
+
+    TEST_CASE("[jsb] shadow environment pool")
+    {
+        GodotJSScriptLanguageIniter initer;
+        const GodotJSScriptLanguage* lang = GodotJSScriptLanguage::get_singleton();
+
+        ShadowEnvironmentStats begin;
+        lang->get_shadow_environment_stats(begin);
+        for (int i = 0; i < 2; ++i)
+        {
+            ShadowEnvironmentUser user;
+            Thread thread;
+            thread.start(&ShadowEnvironmentUser::run, &user);
+            thread.wait_to_finish();
+            CHECK(user.is_shadow);
+            CHECK(user.is_valid);
+        }
+
+        // the first one is prewarmed or created on demand, and recycled for the second one
+        ShadowEnvironmentStats end;
+        lang->get_shadow_environment_stats(end);
+        CHECK((end.misses - begin.misses) + (end.hits - begin.hits) == 2);
+        CHECK(end.hits - begin.hits >= 1);
+        CHECK(end.in_use == 0);
+        CHECK(end.idle >= 1);
+
+        // without prewarming, environments which have run user code are reused as is
+        if (internal::Settings::get_shadow_environment_prewarm_num() == 0)
+        {
+            return;
+        }
+
+        // an environment which has run user code is replaced by a fresh one instead of leaking its global states to the next user
+        {
+            ShadowEnvironmentUser user;
+            user.source = "globalThis.__jsb_shadow_leak = 1; typeof globalThis.__jsb_shadow_leak";
+            Thread thread;
+            thread.start(&ShadowEnvironmentUser::run, &user);
+            thread.wait_to_finish();
+            CHECK(user.result == Variant("number"));
+        }
+        {
+            ShadowEnvironmentUser user;
+            user.source = "typeof globalThis.__jsb_shadow_leak";
+            Thread thread;
+            thread.start(&ShadowEnvironmentUser::run, &user);
+            thread.wait_to_finish();
+            CHECK(user.result == Variant("undefined"));
+        }
+        lang->get_shadow_environment_stats(begin);
+        CHECK(begin.disposed - end.disposed == 2);
+        CHECK(begin.in_use == 0);
+    }
+
     TEST_CASE("[jsb] Godot Object Class prototype checks")
     {
         GodotJSScriptLanguageIniter initer;
@@ -431,6 +926,35 @@ console.assert(!gd.is_instance_valid(inst));
         CHECK(err == OK);
     }
 
+    TEST_CASE("[jsb] Scripts: onready")
+    {
+        GodotJSScriptLanguageIniter initer;
+
+        const Ref<Script> script = ResourceLoader::load("res://test_onready.ts");
+        REQUIRE(script.is_valid());
+
+        // the plan is compiled on the first instance of the class, and reused by the following ones
+        for (int i = 0; i < 2; ++i)
+        {
+            Node* node = memnew(Node);
+            Node* child = memnew(Node);
+            Node* grandchild = memnew(Node);
+            child->set_name("A");
+            grandchild->set_name("B");
+            child->add_child(grandchild);
+            node->add_child(child);
+            node->set_script(script);
+            REQUIRE(node->get_script_instance());
+
+            Callable::CallError error;
+            node->callp(StringName("_ready"), nullptr, 0, error);
+            const Variant summary = node->callp(StringName("summary"), nullptr, 0, error);
+            CHECK(error.error == Callable::CallError::CALL_OK);
+            CHECK(summary == Variant("A,,B"));
+            memdelete(node);
+        }
+    }
+
     TEST_CASE("[jsb] load stub module")
     {
         GodotJSScriptLanguageIniter initer;
@@ -446,6 +970,47 @@ console.assert(!gd.is_instance_valid(inst));
         }
     }
 
+#if JSB_SUPPORT_RELOAD && defined(TOOLS_ENABLED)
+    TEST_CASE("[jsb] module dependents")
+    {
+        GodotJSScriptLanguageIniter initer;
+
+        std::shared_ptr<jsb::Environment> env = GodotJSScriptLanguage::get_singleton()->get_environment();
+        {
+            JSB_TESTS_EXECUTION_SCOPE(env.get());
+            JavaScriptModuleCache& cache = env->get_module_cache();
+            JavaScriptModule& a = cache.insert(env->get_isolate(), env->get_context(), "test_dep_a", false, true);
+            JavaScriptModule& b = cache.insert(env->get_isolate(), env->get_context(), "test_dep_b", false, true);
+            JavaScriptModule& c = cache.insert(env->get_isolate(), env->get_context(), "test_dep_c", false, true);
+            JavaScriptModule& d = cache.insert(env->get_isolate(), env->get_context(), "test_dep_d", false, true);
+
+            // b -> a, c -> b, d -> a, a -> c (cyclic)
+            a.add_dependent(b.id);
+            a.add_dependent(b.id);
+            a.add_dependent(a.id);
+            b.add_dependent(c.id);
+            a.add_dependent(d.id);
+            c.add_dependent(a.id);
+            CHECK(a.dependents.size() == 2);
+
+            Vector<StringName> dependents;
+            cache.collect_dependents(a.id, dependents);
+            CHECK(dependents.size() == 3);
+            CHECK(dependents[0] == b.id);
+            CHECK(dependents[1] == d.id);
+            CHECK(dependents[2] == c.id);
+
+            dependents.clear();
+            cache.collect_dependents(d.id, dependents);
+            CHECK(dependents.is_empty());
+
+            // stub modules are not reloadable
+            CHECK(!d.mark_as_dependent_reloading());
+            CHECK(d.is_loaded());
+        }
+    }
+#endif
+
     TEST_CASE("[jsb] load module")
     {
         GodotJSScriptLanguageIniter initer;
@@ -473,6 +1038,121 @@ console.assert(!gd.is_instance_valid(inst));
         }
     }
 
+    TEST_CASE("[jsb] BootstrapCache")
+    {
+        GodotJSScriptLanguageIniter initer;
+
+        static constexpr char source[] = "(function () { return 42; })";
+        const String name = "test:bootstrap_cache.js";
+        const BootstrapCache::Stats stats = BootstrapCache::get_stats();
+
+        std::shared_ptr<Environment> env = GodotJSScriptLanguage::get_singleton()->get_environment();
+        {
+            JSB_TESTS_EXECUTION_SCOPE(env.get());
+            const v8::Local<v8::Context> context = env->get_context();
+
+            // compiled from source at the first time, and then from the cache
+            for (int i = 0; i < 2; ++i)
+            {
+                impl::TryCatch try_catch(env->get_isolate());
+                v8::Local<v8::Value> rval;
+                CHECK(BootstrapCache::compile_function(context, source, (int) sizeof(source) - 1, name).ToLocal(&rval));
+                CHECK(!try_catch.has_caught());
+                CHECK(rval->IsFunction());
+            }
+        }
+
+#if JSB_WITH_BOOTSTRAP_CACHE && (JSB_WITH_V8 || JSB_WITH_QUICKJS)
+        const BootstrapCache::Stats new_stats = BootstrapCache::get_stats();
+        CHECK(new_stats.misses == stats.misses + 1);
+        CHECK(new_stats.hits == stats.hits + 1);
+        CHECK(new_stats.entries >= 1);
+#endif
+    }
+
+    TEST_CASE("[jsb] JsonModuleCache")
+    {
+        GodotJSScriptLanguageIniter initer;
+
+        static constexpr char source[] = "{ \"name\": \"item\", \"values\": [1, 2, 3] }";
+        const String path = "res://test/json_module_cache.json";
+        const JsonModuleCache::Stats stats = JsonModuleCache::get_stats();
+
+        std::shared_ptr<Environment> env = GodotJSScriptLanguage::get_singleton()->get_environment();
+        {
+            JSB_TESTS_EXECUTION_SCOPE(env.get());
+            v8::Isolate* isolate = env->get_isolate();
+            const v8::Local<v8::Context> context = env->get_context();
+
+            // parsed at the first time, and then read from the cache
+            for (int i = 0; i < 2; ++i)
+            {
+                impl::TryCatch try_catch(isolate);
+                v8::Local<v8::Value> rval;
+                CHECK(JsonModuleCache::parse(isolate, context, path, (const uint8_t*) source, ::std::size(source) - 1).ToLocal(&rval));
+                CHECK(!try_catch.has_caught());
+                REQUIRE(rval->IsObject());
+                v8::Local<v8::Value> name;
+                CHECK(rval.As<v8::Object>()->Get(context, impl::Helper::new_string(isolate, "name")).ToLocal(&name));
+                CHECK(impl::Helper::to_string(isolate, name) == "item");
+            }
+        }
+
+#if JSB_WITH_JSON_MODULE_CACHE && JSB_WITH_QUICKJS
+        const JsonModuleCache::Stats new_stats = JsonModuleCache::get_stats();
+        CHECK(new_stats.misses == stats.misses + 1);
+        CHECK(new_stats.hits == stats.hits + 1);
+        CHECK(new_stats.entries >= 1);
+#endif
+        JsonModuleCache::clear();
+    }
+
+    TEST_CASE("[jsb] ObjectBindingMetadata")
+    {
+        const ClassDB::ClassInfo* class_info = ClassDB::classes.getptr(jsb_string_name(Node));
+        REQUIRE(class_info);
+
+        const std::shared_ptr<const ObjectBindingMetadata> metadata = ObjectBindingMetadata::get(class_info);
+        REQUIRE(metadata);
+        CHECK(metadata->name == jsb_string_name(Node));
+        CHECK(!metadata->is_singleton);
+
+        // shared, built only once
+        const ObjectBindingMetadata::Stats stats = ObjectBindingMetadata::get_stats();
+        CHECK(ObjectBindingMetadata::get(class_info) == metadata);
+        CHECK(ObjectBindingMetadata::get_stats().hits == stats.hits + 1);
+        CHECK(ObjectBindingMetadata::get_stats().misses == stats.misses);
+
+        bool has_method = false;
+        for (const ObjectBindingMetadata::Method& method : metadata->methods)
+        {
+            if (method.name == StringName("add_child")) { has_method = true; CHECK(method.bind); }
+        }
+        CHECK(has_method);
+
+        bool has_signal = false;
+        for (const StringName& signal_name : metadata->signals)
+        {
+            if (signal_name == StringName("ready")) has_signal = true;
+        }
+        CHECK(has_signal);
+
+        bool has_enum = false;
+        for (const ObjectBindingMetadata::Enumeration& enumeration : metadata->enums)
+        {
+            if (enumeration.name == StringName("ProcessMode")) { has_enum = true; CHECK(!enumeration.values.is_empty()); }
+        }
+        CHECK(has_enum);
+
+        // core classes are kept when extensions change
+        CHECK(metadata->api == ClassDB::API_CORE);
+        ObjectBindingMetadata::clear_extension_classes();
+        CHECK(ObjectBindingMetadata::get(class_info) == metadata);
+
+        ObjectBindingMetadata::clear();
+        CHECK(ObjectBindingMetadata::get_stats().classes == 0);
+    }
+
     TEST_CASE("[jsb] RefCounted objects")
     {
         WeakRef* weak_ref = memnew(WeakRef);
@@ -508,6 +1188,488 @@ file = undefined;
         CHECK(weak_ref->get_ref().is_null());
         memdelete(weak_ref);
     }
+
+    TEST_CASE("[jsb] Array/Dictionary proxies")
+    {
+        GodotJSScriptLanguageIniter initer;
+
+        const std::shared_ptr<Environment> env = GodotJSScriptLanguage::get_singleton()->get_environment();
+        Array array;
+        array.push_back(1);
+        array.push_back("two");
+        Dictionary dict;
+        dict["a"] = 1;
+        dict[StringName("b")] = "two";
+        dict[3] = 3;
+        {
+            JSB_TESTS_EXECUTION_SCOPE(env.get());
+
+            v8::Isolate* isolate = env->get_isolate();
+            v8::Local<v8::Context> context = env->get_context();
+            v8::Local<v8::Value> rval;
+            CHECK(TypeConvert::gd_var_to_js(isolate, context, array, rval));
+            context->Global()->Set(context, impl::Helper::new_string(isolate, "g_array"), rval).Check();
+            CHECK(TypeConvert::gd_var_to_js(isolate, context, dict, rval));
+            context->Global()->Set(context, impl::Helper::new_string(isolate, "g_dict"), rval).Check();
+        }
+
+        Error err;
+        GodotJSScriptLanguage::get_singleton()->eval_source(R"--(
+const check = function (cond, message) { if (!cond) throw new Error(message); };
+const a = g_array.proxy();
+check(a.length === 2 && a[0] === 1 && a[1] === "two", "array get");
+check(a[2] === undefined && !(2 in a) && (1 in a), "array bounds");
+a[0] = 10;
+check(!Reflect.set(a, 5, 0), "array set out of range");
+check(JSON.stringify(Object.keys(a)) === '["0","1"]', "array keys");
+check(JSON.stringify(a.toJS()) === '[10,"two"]' && Array.isArray(g_array.toJS()), "array toJS");
+
+const d = g_dict.proxy();
+check(d.a === 1 && d.b === "two" && d.c === undefined, "dict get");
+check(("a" in d) && !("c" in d), "dict has");
+d.c = 30;
+delete d.a;
+check(JSON.stringify(Object.keys(d).sort()) === '["b","c"]', "dict keys");
+const snapshot = g_dict.toJS();
+check(snapshot.b === "two" && snapshot.c === 30 && snapshot["3"] === 3 && d.toJS().c === 30, "dict toJS");
+delete globalThis.g_array;
+delete globalThis.g_dict;
+)--", err);
+        CHECK(err == OK);
+        CHECK(array[0] == Variant(10));
+        CHECK(array.size() == 2);
+        CHECK(!dict.has("a"));
+        CHECK(dict["c"] == Variant(30));
+    }
+
+    TEST_CASE("[jsb] container conversion")
+    {
+        GodotJSScriptLanguageIniter initer;
+
+        const std::shared_ptr<Environment> env = GodotJSScriptLanguage::get_singleton()->get_environment();
+        Error err;
+        GodotJSScriptLanguage::get_singleton()->eval_source(R"--(
+globalThis.__jsb_test = {
+    nested: { name: "root", items: [1, "two", { three: 3 }, [4]], empty: {}, nil: null },
+    cyclic: (function () { const obj = { list: [] }; obj.list.push(obj); return obj; })(),
+    deep: (function () { let obj = {}; for (let i = 0; i < 1000; ++i) obj = { child: obj }; return obj; })(),
+    shared: (function () { const leaf = { v: 1 }; return [leaf, leaf]; })(),
+    instance: new (class Foo { constructor() { this.v = 1; } })(),
+    bare: Object.assign(Object.create(null), { v: 1 }),
+    numeric: { "1": "one", 2: "two", name: "mixed" },
+};
+)--", err);
+        REQUIRE(err == OK);
+        {
+            JSB_TESTS_EXECUTION_SCOPE(env.get());
+            v8::Isolate* isolate = env->get_isolate();
+            const v8::Local<v8::Context> context = env->get_context();
+            const v8::Local<v8::Object> values = context->Global()->Get(context, impl::Helper::new_string(isolate, "__jsb_test")).ToLocalChecked().As<v8::Object>();
+            const auto get = [&](const char* p_name) { return values->Get(context, impl::Helper::new_string(isolate, p_name)).ToLocalChecked(); };
+
+            Variant nested;
+            REQUIRE(TypeConvert::js_to_gd_container(isolate, context, get("nested"), nested));
+            REQUIRE(nested.get_type() == Variant::DICTIONARY);
+            const Dictionary root = nested;
+            CHECK(root.size() == 4);
+            CHECK(root["name"] == Variant("root"));
+            CHECK(root["nil"].get_type() == Variant::NIL);
+            CHECK(((Dictionary) root["empty"]).is_empty());
+            const Array items = root["items"];
+            REQUIRE(items.size() == 4);
+            CHECK(items[0] == Variant(1));
+            CHECK(items[1] == Variant("two"));
+            CHECK(((Dictionary) items[2])["three"] == Variant(3));
+            CHECK(((Array) items[3])[0] == Variant(4));
+
+            // a shared value is not a cycle
+            Variant shared;
+            CHECK(TypeConvert::js_to_gd_container(isolate, context, get("shared"), shared));
+            CHECK(((Array) shared).size() == 2);
+
+            // integer-like keys are converted as strings
+            Variant numeric;
+            REQUIRE(TypeConvert::js_to_gd_container(isolate, context, get("numeric"), numeric));
+            REQUIRE(numeric.get_type() == Variant::DICTIONARY);
+            CHECK(((Dictionary) numeric).size() == 3);
+            CHECK(((Dictionary) numeric)["1"] == Variant("one"));
+            CHECK(((Dictionary) numeric)["2"] == Variant("two"));
+            CHECK(((Dictionary) numeric)["name"] == Variant("mixed"));
+
+            Variant failed;
+            CHECK_FALSE(TypeConvert::js_to_gd_container(isolate, context, get("cyclic"), failed));
+            CHECK_FALSE(TypeConvert::js_to_gd_container(isolate, context, get("deep"), failed));
+
+            // implicit conversion with the expected type
+            Variant dict;
+            CHECK(TypeConvert::can_convert_strict(isolate, context, get("nested"), Variant::DICTIONARY));
+            CHECK(TypeConvert::js_to_gd_var(isolate, context, get("nested"), Variant::DICTIONARY, dict));
+            CHECK(dict == nested);
+            CHECK_FALSE(TypeConvert::js_to_gd_var(isolate, context, get("instance"), Variant::DICTIONARY, dict));
+
+            // only plain objects (Object.prototype or null as the prototype) match a Dictionary parameter in overload resolution
+            CHECK_FALSE(TypeConvert::can_convert_strict(isolate, context, get("instance"), Variant::DICTIONARY));
+            CHECK(TypeConvert::can_convert_strict(isolate, context, get("bare"), Variant::DICTIONARY));
+            CHECK(TypeConvert::js_to_gd_var(isolate, context, get("bare"), Variant::DICTIONARY, dict));
+            CHECK(((Dictionary) dict)["v"] == Variant(1));
+        }
+
+        GodotJSScriptLanguage::get_singleton()->eval_source("delete globalThis.__jsb_test;", err).ignore();
+    }
+
+    TEST_CASE("[jsb] EnvironmentHandle")
+    {
+        EnvironmentHandle handle;
+        CHECK_FALSE(handle.lock());
+        {
+            GodotJSScriptLanguageIniter initer;
+            const std::shared_ptr<Environment> env = GodotJSScriptLanguage::get_singleton()->get_environment();
+            handle = env->get_handle();
+            CHECK(handle.lock() == env);
+        }
+        // invalid after disposed
+        CHECK_FALSE(handle.lock());
+    }
+
+    TEST_CASE("[jsb] FunctionRegistry")
+    {
+        GodotJSScriptLanguageIniter initer;
+
+        const std::shared_ptr<Environment> env = GodotJSScriptLanguage::get_singleton()->get_environment();
+        Error err;
+        GodotJSScriptLanguage::get_singleton()->eval_source("globalThis.__jsb_test = [function () {}, function () {}];", err);
+        REQUIRE(err == OK);
+        {
+            JSB_TESTS_EXECUTION_SCOPE(env.get());
+            v8::Isolate* isolate = env->get_isolate();
+            const v8::Local<v8::Context> context = env->get_context();
+            const v8::Local<v8::Object> funcs = context->Global()->Get(context, impl::Helper::new_string(isolate, "__jsb_test")).ToLocalChecked().As<v8::Object>();
+            const v8::Local<v8::Function> func1 = funcs->Get(context, 0u).ToLocalChecked().As<v8::Function>();
+            const v8::Local<v8::Function> func2 = funcs->Get(context, 1u).ToLocalChecked().As<v8::Function>();
+
+            FunctionRegistry registry;
+
+            // the same function registered repeatedly holds one slot
+            const ObjectCacheID id1 = registry.retain(isolate, func1);
+            for (int i = 1; i < 50; ++i) CHECK(registry.retain(isolate, func1) == id1);
+            const ObjectCacheID id2 = registry.retain(isolate, func2);
+            CHECK(id1 != id2);
+            CHECK(registry.get(isolate, id1) == func1);
+            CHECK(registry.get(isolate, id2) == func2);
+            CHECK(registry.get_stats().live == 2);
+            CHECK(registry.get_stats().dedup_hits == 49);
+
+            for (int i = 1; i < 50; ++i) CHECK(registry.release(id1));
+            CHECK(registry.is_valid(id1));
+            CHECK(registry.release(id1));
+            CHECK_FALSE(registry.is_valid(id1));
+            CHECK(registry.get_stats().live == 1);
+
+            // a stale id fails even if the slot is recycled
+            const ObjectCacheID id3 = registry.retain(isolate, func1);
+            CHECK(id3 != id1);
+            CHECK_FALSE(registry.release(id1));
+            CHECK(registry.get(isolate, id3) == func1);
+            CHECK(registry.get_stats().live == 2);
+            CHECK(registry.get_stats().peak == 2);
+
+            registry.clear();
+            CHECK_FALSE(registry.is_valid(id2));
+            CHECK_FALSE(registry.is_valid(id3));
+            CHECK(registry.get_stats().live == 0);
+            CHECK(registry.get_stats().peak == 2);
+        }
+
+        GodotJSScriptLanguage::get_singleton()->eval_source("delete globalThis.__jsb_test;", err).ignore();
+    }
+
+    TEST_CASE("[jsb] Signal emission")
+    {
+        GodotJSScriptLanguageIniter initer;
+
+        Error err;
+        GodotJSScriptLanguage::get_singleton()->eval_source(R"--(
+const gd = require("godot");
+const check = function (cond, message) { if (!cond) throw new Error(message); };
+const emitter = new gd.Object();
+const node = new gd.Node();
+emitter.add_user_signal("js_only");
+emitter.add_user_signal("mixed");
+
+// javascript receivers get the original values (a plain object is not translatable as Variant)
+const payload = { value: 1 };
+let received = 0, once = 0, thiz = undefined;
+emitter.connect("js_only", gd.Callable.create(function (v) { check(v === payload, "identity"); ++received; }));
+emitter.connect("js_only", gd.Callable.create(node, function () { thiz = this; }));
+emitter.connect("js_only", gd.Callable.create(function () { ++once; }), gd.Object.ConnectFlags.CONNECT_ONE_SHOT);
+const js_only = new gd.Signal(emitter, "js_only");
+js_only.emit(payload);
+js_only.emit(payload);
+check(received === 2 && once === 1 && thiz === node, "js receivers");
+
+// native receivers get the translated values
+let name = undefined;
+emitter.connect("mixed", gd.Callable.create(function (v) { name = v; }));
+emitter.connect("mixed", gd.Callable.create(node, "set_name"));
+new gd.Signal(emitter, "mixed").emit("renamed");
+check(name === "renamed" && node.get_name() == "renamed", "mixed receivers");
+
+node.free();
+emitter.free();
+)--", err);
+        CHECK(err == OK);
+    }
+
+#if !JSB_WITH_WEB && !JSB_WITH_JAVASCRIPTCORE
+    TEST_CASE("[jsb] Worker memory limit")
+    {
+        GodotJSScriptLanguageIniter initer;
+        std::shared_ptr<Environment> env = GodotJSScriptLanguage::get_singleton()->get_environment();
+
+        const String dir = internal::PathUtil::combine(internal::Settings::get_jsb_out_res_path(), "jsb_tests");
+        CHECK(DirAccess::make_dir_recursive_absolute(dir) == OK);
+        {
+            // keep allocating until the worker is terminated
+            const Ref<FileAccess> file = FileAccess::open(internal::PathUtil::combine(dir, "memory_hog_worker.js"), FileAccess::WRITE);
+            REQUIRE(file.is_valid());
+            file->store_string("const hog = [];\nsetInterval(function () { hog.push(new Array(64 * 1024).fill(1)); }, 1);\n");
+        }
+
+        Error err;
+        GodotJSScriptLanguage::get_singleton()->eval_source(R"--(
+(function() {
+const { JSWorker } = require("godot.worker");
+const worker = new JSWorker("jsb_tests/memory_hog_worker", { softMemoryLimit: 16 * 1024 * 1024, hardMemoryLimit: 32 * 1024 * 1024 });
+globalThis.__jsb_test = { error: undefined };
+worker.onerror = function (error) { globalThis.__jsb_test.error = error; };
+})()
+)--", err);
+        CHECK(err == OK);
+
+        // pump the master environment until the error is reported by the worker
+        bool reported = false;
+        const uint64_t begin = OS::get_singleton()->get_ticks_msec();
+        while (OS::get_singleton()->get_ticks_msec() - begin < 10 * 1000)
+        {
+            env->update(10);
+            if ((bool) GodotJSScriptLanguage::get_singleton()->eval_source("__jsb_test.error !== undefined", err).to_variant())
+            {
+                reported = true;
+                break;
+            }
+            OS::get_singleton()->delay_usec(10 * 1000);
+        }
+        CHECK(reported);
+        const String error = GodotJSScriptLanguage::get_singleton()->eval_source("String(__jsb_test.error)", err).to_variant();
+        CHECK(error.contains("memory limit exceeded"));
+        GodotJSScriptLanguage::get_singleton()->eval_source("delete globalThis.__jsb_test;", err).ignore();
+        CHECK(DirAccess::remove_absolute(internal::PathUtil::combine(dir, "memory_hog_worker.js")) == OK);
+    }
+#endif
+
+#if !JSB_WITH_WEB
+    TEST_CASE("[jsb] require.async")
+    {
+        GodotJSScriptLanguageIniter initer;
+        std::shared_ptr<Environment> env = GodotJSScriptLanguage::get_singleton()->get_environment();
+
+        const String dir = internal::PathUtil::combine(internal::Settings::get_jsb_out_res_path(), "jsb_tests");
+        CHECK(DirAccess::make_dir_recursive_absolute(dir) == OK);
+        {
+            const Ref<FileAccess> file = FileAccess::open(internal::PathUtil::combine(dir, "async_main.js"), FileAccess::WRITE);
+            REQUIRE(file.is_valid());
+            file->store_string("const dep = require(\"./async_dep\");\nexports.value = dep.value + 1;\n");
+        }
+        {
+            const Ref<FileAccess> file = FileAccess::open(internal::PathUtil::combine(dir, "async_dep.js"), FileAccess::WRITE);
+            REQUIRE(file.is_valid());
+            file->store_string("exports.value = 41;\n");
+        }
+
+        const internal::FileManager::Stats file_stats = internal::FileManager::get_stats();
+        Error err;
+        GodotJSScriptLanguage::get_singleton()->eval_source(R"--(
+globalThis.__jsb_test = { value: undefined, error: undefined };
+require.async("jsb_tests/async_main").then(function (exports) { globalThis.__jsb_test.value = exports.value; });
+require.async("jsb_tests/async_missing").catch(function (error) { globalThis.__jsb_test.error = error; });
+)--", err);
+        CHECK(err == OK);
+
+        // pump the environment until both requests are settled
+        const uint64_t begin = OS::get_singleton()->get_ticks_msec();
+        while (!env->get_module_fetcher().is_idle() && OS::get_singleton()->get_ticks_msec() - begin < 10 * 1000)
+        {
+            env->update(10);
+            OS::get_singleton()->delay_usec(1000);
+        }
+        env->update(10);
+        CHECK(env->get_module_fetcher().is_idle());
+        CHECK((int) GodotJSScriptLanguage::get_singleton()->eval_source("__jsb_test.value", err).to_variant() == 42);
+        CHECK((bool) GodotJSScriptLanguage::get_singleton()->eval_source("__jsb_test.error instanceof Error", err).to_variant());
+
+        // the dependency is fetched along with the requested module
+        const ModuleFetcher::Stats stats = env->get_module_fetcher().get_stats();
+        CHECK(stats.fetched == 2);
+
+        // and the resolver reads them from the cache
+        CHECK(internal::FileManager::get_stats().hits >= file_stats.hits + 2);
+        GodotJSScriptLanguage::get_singleton()->eval_source("delete globalThis.__jsb_test;", err).ignore();
+        CHECK(DirAccess::remove_absolute(internal::PathUtil::combine(dir, "async_main.js")) == OK);
+        CHECK(DirAccess::remove_absolute(internal::PathUtil::combine(dir, "async_dep.js")) == OK);
+    }
+
+    TEST_CASE("[jsb] FileManager")
+    {
+        const String dir = internal::PathUtil::combine(internal::Settings::get_jsb_out_res_path(), "jsb_tests");
+        CHECK(DirAccess::make_dir_recursive_absolute(dir) == OK);
+        const String path = internal::PathUtil::combine(dir, "prefetched.js");
+        {
+            const Ref<FileAccess> file = FileAccess::open(path, FileAccess::WRITE);
+            REQUIRE(file.is_valid());
+            file->store_string("exports.value = 1;\n");
+        }
+        internal::FileManager::clear();
+
+        internal::FileManager::prefetch(path);
+        const uint64_t begin = OS::get_singleton()->get_ticks_msec();
+        while (internal::FileManager::get_state(path) == internal::FileManager::FileState::Pending && OS::get_singleton()->get_ticks_msec() - begin < 10 * 1000)
+        {
+            OS::get_singleton()->delay_usec(1000);
+        }
+        CHECK(internal::FileManager::get_state(path) == internal::FileManager::FileState::Cached);
+
+        const internal::FileManager::Stats stats = internal::FileManager::get_stats();
+        internal::FileContent content;
+        CHECK(internal::FileManager::read(path, content));
+        CHECK(content.get_length() == 19);
+        CHECK(content.bytes[(int) content.get_length()] == 0);
+        CHECK(internal::FileManager::get_stats().hits == stats.hits + 1);
+
+        // the failure is kept until it's prefetched or read again
+        CHECK_FALSE(internal::FileManager::read(internal::PathUtil::combine(dir, "prefetched_missing.js"), content));
+        CHECK(internal::FileManager::get_state(internal::PathUtil::combine(dir, "prefetched_missing.js")) == internal::FileManager::FileState::Failed);
+
+        internal::FileManager::clear();
+        CHECK(internal::FileManager::get_state(path) == internal::FileManager::FileState::None);
+        CHECK(DirAccess::remove_absolute(path) == OK);
+    }
+
+#if JSB_SUPPORT_RELOAD && defined(TOOLS_ENABLED)
+    TEST_CASE("[jsb] scan external changes")
+    {
+        GodotJSScriptLanguageIniter initer;
+        std::shared_ptr<Environment> env = GodotJSScriptLanguage::get_singleton()->get_environment();
+
+        const String dir = internal::PathUtil::combine(internal::Settings::get_jsb_out_res_path(), "jsb_tests");
+        CHECK(DirAccess::make_dir_recursive_absolute(dir) == OK);
+        const String helper_path = internal::PathUtil::combine(dir, "reload_helper.js");
+        const String importer_path = internal::PathUtil::combine(dir, "reload_importer.js");
+        {
+            const Ref<FileAccess> file = FileAccess::open(helper_path, FileAccess::WRITE);
+            REQUIRE(file.is_valid());
+            file->store_string("exports.value = 1;\n");
+        }
+        {
+            // the value is copied when the importer is executed
+            const Ref<FileAccess> file = FileAccess::open(importer_path, FileAccess::WRITE);
+            REQUIRE(file.is_valid());
+            file->store_string("const helper = require(\"./reload_helper\");\nexports.value = helper.value;\n");
+        }
+
+        Error err;
+        CHECK(env->load("jsb_tests/reload_importer") == OK);
+        CHECK((int) GodotJSScriptLanguage::get_singleton()->eval_source("require(\"jsb_tests/reload_importer\").value", err).to_variant() == 1);
+
+        // the modified time has only 1 second resolution
+        OS::get_singleton()->delay_usec(1100 * 1000);
+        {
+            const Ref<FileAccess> file = FileAccess::open(helper_path, FileAccess::WRITE);
+            REQUIRE(file.is_valid());
+            file->store_string("exports.value = 2;\n");
+        }
+
+        // the importer is re-executed along with the changed helper (it's not a script, so not left to the caller)
+        Vector<StringName> script_dependents;
+        env->scan_external_changes(&script_dependents);
+        CHECK(script_dependents.is_empty());
+        CHECK((int) GodotJSScriptLanguage::get_singleton()->eval_source("require(\"jsb_tests/reload_importer\").value", err).to_variant() == 2);
+
+        CHECK(DirAccess::remove_absolute(helper_path) == OK);
+        CHECK(DirAccess::remove_absolute(importer_path) == OK);
+    }
+#endif
+
+#if JSB_JSON_LAZY_THRESHOLD
+    TEST_CASE("[jsb] Lazy JSON module")
+    {
+        GodotJSScriptLanguageIniter initer;
+
+        const String dir = internal::PathUtil::combine(internal::Settings::get_jsb_out_res_path(), "jsb_tests");
+        CHECK(DirAccess::make_dir_recursive_absolute(dir) == OK);
+        {
+            const Ref<FileAccess> file = FileAccess::open(internal::PathUtil::combine(dir, "lazy_table.json"), FileAccess::WRITE);
+            REQUIRE(file.is_valid());
+            file->store_string("[");
+            for (int i = 0; file->get_position() < JSB_JSON_LAZY_THRESHOLD; ++i)
+            {
+                file->store_string(jsb_format("%s{\"id\": %d}", i == 0 ? "" : ", ", i));
+            }
+            file->store_string("]");
+        }
+
+        Error err;
+        CHECK((bool) GodotJSScriptLanguage::get_singleton()->eval_source("Array.isArray(require(\"jsb_tests/lazy_table.json\"))", err).to_variant());
+        CHECK(err == OK);
+        CHECK((int) GodotJSScriptLanguage::get_singleton()->eval_source("require(\"jsb_tests/lazy_table.json\")[7].id", err).to_variant() == 7);
+        CHECK((int) GodotJSScriptLanguage::get_singleton()->eval_source("require(\"jsb_tests/lazy_table.json\").filter(function (it) { return it.id < 3; }).length", err).to_variant() == 3);
+
+        // the proxy invariants hold after freezing (the target is kept in sync)
+        CHECK((bool) GodotJSScriptLanguage::get_singleton()->eval_source(R"--(
+(function () {
+    const table = Object.freeze(require("jsb_tests/lazy_table.json"));
+    return Object.isFrozen(table) && !Object.isExtensible(table) && table[7].id === 7 && Object.getOwnPropertyDescriptor(table, "0").writable === false;
+})()
+)--", err).to_variant());
+        CHECK(err == OK);
+
+        // the source changed between require and the first access
+        const String changed_path = internal::PathUtil::combine(dir, "lazy_changed.json");
+        const auto write_changed = [&](int p_value)
+        {
+            const Ref<FileAccess> file = FileAccess::open(changed_path, FileAccess::WRITE);
+            REQUIRE(file.is_valid());
+            file->store_string("{");
+            for (int i = 0; file->get_position() < JSB_JSON_LAZY_THRESHOLD; ++i)
+            {
+                file->store_string(jsb_format("%s\"k%d\": %d", i == 0 ? "" : ", ", i, p_value));
+            }
+            file->store_string("}");
+        };
+        write_changed(0);
+        GodotJSScriptLanguage::get_singleton()->eval_source("globalThis.__jsb_lazy = require(\"jsb_tests/lazy_changed.json\");", err).ignore();
+        CHECK(err == OK);
+        write_changed(1);
+        // the exports are the content when it's required
+        internal::FileManager::clear();
+        CHECK((int) GodotJSScriptLanguage::get_singleton()->eval_source("__jsb_lazy.k0", err).to_variant() == 0);
+        CHECK(err == OK);
+        CHECK((int) GodotJSScriptLanguage::get_singleton()->eval_source("__jsb_lazy.k1", err).to_variant() == 0);
+        GodotJSScriptLanguage::get_singleton()->eval_source("delete globalThis.__jsb_lazy;", err).ignore();
+        CHECK(DirAccess::remove_absolute(changed_path) == OK);
+        CHECK(DirAccess::remove_absolute(internal::PathUtil::combine(dir, "lazy_table.json")) == OK);
+    }
+#endif
+
+    TEST_CASE("[jsb] ModuleFetcher::scan_dependencies")
+    {
+        const char source[] = "const a = require(\"./a\"); const b = require ( 'b/c' ); obj.require(\"x\"); my_require(\"y\"); require(name); require(\"\");";
+        Vector<String> module_ids;
+        ModuleFetcher::scan_dependencies(source, ::std::size(source) - 1, module_ids);
+        REQUIRE(module_ids.size() == 2);
+        CHECK(module_ids[0] == "./a");
+        CHECK(module_ids[1] == "b/c");
+    }
+#endif
 }
 
 #endif
@@ -0,0 +1,699 @@
+#ifndef GODOTJS_TESTS_JSB_BENCHMARKS_H
+#define GODOTJS_TESTS_JSB_BENCHMARKS_H
+
+#include "jsb_test_helpers.h"
+#include "../bridge/jsb_type_convert.h"
+#include "../internal/jsb_settings.h"
+#include "../internal/jsb_path_util.h"
+#include "core/math/random_pcg.h"
+
+#include <string>
+
+// Microbenchmarks of the bridge (skipped by default).
+// Run them with: godot --test --test-case="[jsb][Benchmark]*" --no-skip
+//
+// Each result is printed as a JSON line, and appended to the file specified by the environment variable
+// `JSB_BENCHMARK_OUTPUT` (JSON Lines, truncated on the first result in the process) if set.
+namespace jsb::tests
+{
+    struct Benchmark
+    {
+        // fixed iteration counts, keep them unchanged to make the results comparable between releases
+        static constexpr uint64_t kCallIterations = 200000;
+        static constexpr uint64_t kLookupIterations = 1000000;
+        static constexpr int kLookupThreads = 4;
+        static constexpr uint64_t kConvertIterations = 100000;
+        static constexpr uint64_t kPackedConvertIterations = 10000;
+        static constexpr int kPackedArraySize = 1024;
+        static constexpr uint64_t kStringIterations = 100000;
+        static constexpr uint64_t kSignalIterations = 1000;
+        static constexpr int kSignalListeners = 1000;
+        static constexpr uint64_t kContainerIterations = 20;
+        static constexpr int kContainerItems = 8000;
+        static constexpr uint64_t kBoxedIterations = 100000;
+        static constexpr uint64_t kBindingIterations = 20000;
+        static constexpr uint64_t kTimerIterations = 20000;
+        static constexpr uint64_t kModuleIterations = 200;
+        static constexpr uint64_t kWorkerIterations = 2000;
+        static constexpr uint64_t kWarmupIterations = 100;
+
+        // max time to wait for the asynchronous benchmarks (timers, workers)
+        static constexpr uint64_t kWaitTimeoutUsec = 30 * 1000 * 1000;
+
+        static constexpr char kOutputEnv[] = "JSB_BENCHMARK_OUTPUT";
+
+        static const char* get_runtime_name()
+        {
+#if JSB_WITH_V8
+            return "v8";
+#elif JSB_WITH_QUICKJS && JSB_PREFER_QUICKJS_NG
+            return "quickjs-ng";
+#elif JSB_WITH_QUICKJS
+            return "quickjs";
+#elif JSB_WITH_JAVASCRIPTCORE
+            return "jsc";
+#elif JSB_WITH_WEB
+            return "web";
+#else
+            return "unknown";
+#endif
+        }
+
+        static void report(const String& p_name, uint64_t p_iterations, uint64_t p_total_usec)
+        {
+            const double ns_per_op = p_iterations != 0 ? (double) p_total_usec * 1000.0 / (double) p_iterations : 0.0;
+            const double ops_per_sec = p_total_usec != 0 ? (double) p_iterations * 1000000.0 / (double) p_total_usec : 0.0;
+
+            Dictionary result;
+            result["name"] = p_name;
+            result["runtime"] = get_runtime_name();
+            result["iterations"] = p_iterations;
+            result["total_usec"] = p_total_usec;
+            result["ns_per_op"] = ns_per_op;
+            result["ops_per_sec"] = ops_per_sec;
+            const String line = JSON::stringify(result, "", false);
+            MESSAGE(line);
+
+            static bool truncated = false;
+            const String output_path = OS::get_singleton()->get_environment(kOutputEnv);
+            if (output_path.is_empty()) return;
+
+            const Ref<FileAccess> file = FileAccess::open(output_path, truncated ? FileAccess::READ_WRITE : FileAccess::WRITE);
+            CHECK(file.is_valid());
+            if (file.is_null()) return;
+            file->seek_end();
+            file->store_line(line);
+            truncated = true;
+        }
+
+        // run `p_func(iterations)` once for warming up (inline caches, lazily exposed classes), then measure it
+        template<typename TFunc>
+        static void run(const String& p_name, uint64_t p_iterations, TFunc&& p_func)
+        {
+            p_func(MIN(p_iterations, kWarmupIterations));
+            const uint64_t begin = OS::get_singleton()->get_ticks_usec();
+            p_func(p_iterations);
+            report(p_name, p_iterations, OS::get_singleton()->get_ticks_usec() - begin);
+        }
+
+        static void eval(const String& p_source)
+        {
+            Error err;
+            GodotJSScriptLanguage::get_singleton()->eval_source(p_source, err).ignore();
+            CHECK(err == OK);
+        }
+
+        static Variant eval_value(const String& p_source)
+        {
+            Error err;
+            const Variant value = GodotJSScriptLanguage::get_singleton()->eval_source(p_source, err).to_variant();
+            CHECK(err == OK);
+            return value;
+        }
+
+        // pump the environment (timers, worker messages) until `p_condition` (a JS expression) is true
+        static bool wait_until(const std::shared_ptr<Environment>& p_env, const String& p_condition)
+        {
+            const uint64_t begin = OS::get_singleton()->get_ticks_usec();
+            uint64_t last_ticks = OS::get_singleton()->get_ticks_msec();
+            while (!(bool) eval_value(p_condition))
+            {
+                if (OS::get_singleton()->get_ticks_usec() - begin > kWaitTimeoutUsec) return false;
+                const uint64_t ticks = OS::get_singleton()->get_ticks_msec();
+                p_env->update(ticks - last_ticks);
+                last_ticks = ticks;
+            }
+            return true;
+        }
+
+        // remove the generated files, they must not be left in the project
+        static void remove_dir(const String& p_dir)
+        {
+            const Ref<DirAccess> dir = DirAccess::open(p_dir);
+            if (dir.is_null()) return;
+            CHECK(dir->erase_contents_recursive() == OK);
+            CHECK(DirAccess::remove_absolute(p_dir) == OK);
+        }
+
+        // a sample value of the given type, or NIL if the type is not benchmarked
+        static Variant make_sample(Variant::Type p_type)
+        {
+            switch (p_type)
+            {
+            // NIL is trivial, OBJECT is covered by the binding benchmarks, CALLABLE/SIGNAL need a live target
+            case Variant::NIL:
+            case Variant::OBJECT:
+            case Variant::CALLABLE:
+            case Variant::SIGNAL:
+                return {};
+            case Variant::BOOL: return true;
+            case Variant::INT: return 123;
+            case Variant::FLOAT: return 1.5;
+            case Variant::STRING: return String("benchmark");
+            case Variant::STRING_NAME: return StringName("benchmark");
+            case Variant::NODE_PATH: return NodePath("benchmark/node");
+            case Variant::ARRAY:
+                {
+                    Array array;
+                    for (int i = 0; i < 16; ++i) array.push_back(i);
+                    return array;
+                }
+            case Variant::DICTIONARY:
+                {
+                    Dictionary dict;
+                    for (int i = 0; i < 16; ++i) dict[i] = i;
+                    return dict;
+                }
+            default: break;
+            }
+
+            Variant value;
+            Callable::CallError error;
+            Variant::construct(p_type, value, nullptr, 0, error);
+            if (error.error != Callable::CallError::CALL_OK) return {};
+            if (p_type >= Variant::PACKED_BYTE_ARRAY)
+            {
+                const Variant size = kPackedArraySize;
+                const Variant* args[] = { &size };
+                Variant ret;
+                value.callp("resize", args, 1, ret, error);
+            }
+            return value;
+        }
+    };
+
+    TEST_CASE("[jsb][Benchmark] Calls" * doctest::skip())
+    {
+        GodotJSScriptLanguageIniter initer;
+        std::shared_ptr<Environment> env = GodotJSScriptLanguage::get_singleton()->get_environment();
+
+        Benchmark::eval(R"--(
+(function() {
+const gd = require("godot");
+const node = new gd.Node();
+const vec = new gd.Vector2(1, 2);
+globalThis.__jsb_bench = {
+    native_call(n) { for (let i = 0; i < n; ++i) node.get_child_count(); },
+    native_call_args(n) { for (let i = 0; i < n; ++i) node.set_process_priority(i); },
+    builtin_call(n) { for (let i = 0; i < n; ++i) vec.length(); },
+    js_func(a) { return a; },
+    dispose() { node.free(); },
+};
+})()
+)--");
+
+        Benchmark::run("call.js_to_native.object_method", Benchmark::kCallIterations, [](uint64_t n) { Benchmark::eval(vformat("__jsb_bench.native_call(%d)", n)); });
+        Benchmark::run("call.js_to_native.object_method_args", Benchmark::kCallIterations, [](uint64_t n) { Benchmark::eval(vformat("__jsb_bench.native_call_args(%d)", n)); });
+        Benchmark::run("call.js_to_native.builtin_method", Benchmark::kCallIterations, [](uint64_t n) { Benchmark::eval(vformat("__jsb_bench.builtin_call(%d)", n)); });
+
+        {
+            JSB_TESTS_EXECUTION_SCOPE(env.get());
+            v8::Isolate* isolate = env->get_isolate();
+            const v8::Local<v8::Context> context = env->get_context();
+            const v8::Local<v8::Object> bench = context->Global()->Get(context, impl::Helper::new_string(isolate, "__jsb_bench")).ToLocalChecked().As<v8::Object>();
+            const v8::Local<v8::Value> func_val = bench->Get(context, impl::Helper::new_string(isolate, "js_func")).ToLocalChecked();
+            REQUIRE(func_val->IsFunction());
+            const v8::Local<v8::Function> func = func_val.As<v8::Function>();
+
+            Benchmark::run("call.native_to_js.function", Benchmark::kCallIterations, [&](uint64_t n)
+            {
+                for (uint64_t i = 0; i < n; ++i)
+                {
+                    v8::HandleScope handle_scope(isolate);
+                    v8::Local<v8::Value> argv[] = { v8::Int32::New(isolate, (int32_t) i) };
+                    func->Call(context, v8::Undefined(isolate), 1, argv).ToLocalChecked();
+                }
+            });
+
+            // through the engine Callable (the path of signals and deferred calls)
+            Variant callable;
+            REQUIRE(TypeConvert::js_to_gd_var(isolate, context, func, Variant::CALLABLE, callable));
+            Benchmark::run("call.native_to_js.callable", Benchmark::kCallIterations, [&](uint64_t n)
+            {
+                const Callable target = callable;
+                const Variant arg = 1;
+                const Variant* args[] = { &arg };
+                for (uint64_t i = 0; i < n; ++i)
+                {
+                    Variant ret;
+                    Callable::CallError error;
+                    target.callp(args, 1, ret, error);
+                }
+            });
+        }
+
+        Benchmark::eval("__jsb_bench.dispose(); delete globalThis.__jsb_bench;");
+    }
+
+    // threads resolving an environment in a loop (like the callables and instance bindings used by workers and loader threads)
+    struct EnvironmentLookupLoad
+    {
+        std::shared_ptr<Environment> env;
+        bool use_handle = false;
+        uint64_t iterations = 0;
+        SafeFlag stop = SafeFlag(false);
+        Thread threads[Benchmark::kLookupThreads];
+
+        // loop until stopped if iterations is zero
+        static void run(void* p_data)
+        {
+            const EnvironmentLookupLoad* self = (const EnvironmentLookupLoad*) p_data;
+            const EnvironmentHandle handle = self->env->get_handle();
+            const EnvironmentID env_id = self->env->id();
+            for (uint64_t i = 0; self->iterations == 0 ? !self->stop.is_set() : i < self->iterations; ++i)
+            {
+                const std::shared_ptr<Environment> env = self->use_handle ? handle.lock() : Environment::_access(env_id);
+                CHECK(env);
+            }
+        }
+
+        void start(int p_num)
+        {
+            stop.clear();
+            for (int i = 0; i < p_num; ++i) threads[i].start(run, this);
+        }
+
+        void wait(int p_num)
+        {
+            stop.set();
+            for (int i = 0; i < p_num; ++i) threads[i].wait_to_finish();
+        }
+    };
+
+    TEST_CASE("[jsb][Benchmark] Environment lookup" * doctest::skip())
+    {
+        GodotJSScriptLanguageIniter initer;
+        std::shared_ptr<Environment> env = GodotJSScriptLanguage::get_singleton()->get_environment();
+
+        // the environment store (locked), and the environment handle (lock-free) resolved from all threads concurrently
+        for (const bool use_handle : { false, true })
+        {
+            EnvironmentLookupLoad load;
+            load.env = env;
+            load.use_handle = use_handle;
+            Benchmark::run(vformat("env.lookup.%s[mt%d]", use_handle ? "handle" : "store", Benchmark::kLookupThreads), Benchmark::kLookupIterations, [&](uint64_t n)
+            {
+                load.iterations = n;
+                load.start(Benchmark::kLookupThreads);
+                load.wait(Benchmark::kLookupThreads);
+            });
+        }
+
+        // Callable invocation while other threads keep resolving the environment from the store
+        Benchmark::eval("globalThis.__jsb_bench = { js_func(a) { return a; } };");
+        {
+            JSB_TESTS_EXECUTION_SCOPE(env.get());
+            v8::Isolate* isolate = env->get_isolate();
+            const v8::Local<v8::Context> context = env->get_context();
+            const v8::Local<v8::Object> bench = context->Global()->Get(context, impl::Helper::new_string(isolate, "__jsb_bench")).ToLocalChecked().As<v8::Object>();
+            const v8::Local<v8::Value> func = bench->Get(context, impl::Helper::new_string(isolate, "js_func")).ToLocalChecked();
+            Variant callable;
+            REQUIRE(TypeConvert::js_to_gd_var(isolate, context, func, Variant::CALLABLE, callable));
+
+            EnvironmentLookupLoad load;
+            load.env = env;
+            load.start(Benchmark::kLookupThreads - 1);
+            Benchmark::run(vformat("call.native_to_js.callable[mt%d]", Benchmark::kLookupThreads), Benchmark::kCallIterations, [&](uint64_t n)
+            {
+                const Callable target = callable;
+                const Variant arg = 1;
+                const Variant* args[] = { &arg };
+                for (uint64_t i = 0; i < n; ++i)
+                {
+                    Variant ret;
+                    Callable::CallError error;
+                    target.callp(args, 1, ret, error);
+                }
+            });
+            load.wait(Benchmark::kLookupThreads - 1);
+        }
+        Benchmark::eval("delete globalThis.__jsb_bench;");
+    }
+
+    TEST_CASE("[jsb][Benchmark] Signals" * doctest::skip())
+    {
+        GodotJSScriptLanguageIniter initer;
+
+        // one emitter with many javascript listeners (in the same environment)
+        Benchmark::eval(vformat(R"--(
+(function() {
+const gd = require("godot");
+const emitter = new gd.Object();
+emitter.add_user_signal("changed");
+let sum = 0;
+for (let i = 0; i < %d; ++i) {
+    emitter.connect("changed", gd.Callable.create(function (value, text) { sum += value; }));
+}
+const signal = new gd.Signal(emitter, "changed");
+globalThis.__jsb_bench = {
+    emit(n) { for (let i = 0; i < n; ++i) signal.emit(i, "payload"); },
+    emit_signal(n) { for (let i = 0; i < n; ++i) emitter.emit_signal("changed", i, "payload"); },
+    dispose() { emitter.free(); },
+};
+})()
+)--", Benchmark::kSignalListeners));
+
+        // `Signal.emit` calls the listeners directly, `Object.emit_signal` goes through the engine (and JSCallable::call)
+        Benchmark::run(vformat("signal.emit.js_listeners[%d]", Benchmark::kSignalListeners), Benchmark::kSignalIterations, [](uint64_t n) { Benchmark::eval(vformat("__jsb_bench.emit(%d)", n)); });
+        Benchmark::run(vformat("signal.emit_signal.js_listeners[%d]", Benchmark::kSignalListeners), Benchmark::kSignalIterations, [](uint64_t n) { Benchmark::eval(vformat("__jsb_bench.emit_signal(%d)", n)); });
+
+        Benchmark::eval("__jsb_bench.dispose(); delete globalThis.__jsb_bench;");
+    }
+
+    TEST_CASE("[jsb][Benchmark] Conversions" * doctest::skip())
+    {
+        GodotJSScriptLanguageIniter initer;
+        std::shared_ptr<Environment> env = GodotJSScriptLanguage::get_singleton()->get_environment();
+
+        JSB_TESTS_EXECUTION_SCOPE(env.get());
+        v8::Isolate* isolate = env->get_isolate();
+        const v8::Local<v8::Context> context = env->get_context();
+
+        for (int type_index = 0; type_index < Variant::VARIANT_MAX; ++type_index)
+        {
+            const Variant::Type type = (Variant::Type) type_index;
+            const Variant sample = Benchmark::make_sample(type);
+            if (sample.get_type() != type) continue;
+
+            const bool packed = type >= Variant::PACKED_BYTE_ARRAY;
+            const uint64_t iterations = packed ? Benchmark::kPackedConvertIterations : Benchmark::kConvertIterations;
+            const String type_name = packed ? vformat("%s[%d]", Variant::get_type_name(type), Benchmark::kPackedArraySize) : Variant::get_type_name(type);
+
+            v8::HandleScope handle_scope(isolate);
+            v8::Local<v8::Value> jval;
+            if (!TypeConvert::gd_var_to_js(isolate, context, sample, jval))
+            {
+                MESSAGE("skip unsupported conversion ", type_name);
+                continue;
+            }
+
+            Benchmark::run("convert.gd_to_js." + type_name, iterations, [&](uint64_t n)
+            {
+                for (uint64_t i = 0; i < n; ++i)
+                {
+                    v8::HandleScope loop_scope(isolate);
+                    v8::Local<v8::Value> out;
+                    TypeConvert::gd_var_to_js(isolate, context, sample, out);
+                }
+            });
+
+            Benchmark::run("convert.js_to_gd." + type_name, iterations, [&](uint64_t n)
+            {
+                for (uint64_t i = 0; i < n; ++i)
+                {
+                    Variant out;
+                    TypeConvert::js_to_gd_var(isolate, context, jval, type, out);
+                }
+            });
+        }
+    }
+
+    TEST_CASE("[jsb][Benchmark] Strings" * doctest::skip())
+    {
+        GodotJSScriptLanguageIniter initer;
+        std::shared_ptr<Environment> env = GodotJSScriptLanguage::get_singleton()->get_environment();
+
+        JSB_TESTS_EXECUTION_SCOPE(env.get());
+        v8::Isolate* isolate = env->get_isolate();
+
+        // short (label) and long (dialog/JSON) payloads of the typical character ranges
+        const String ascii = "The quick brown fox jumps over the lazy dog. ";
+        const String latin1 = String::utf8("Voilà, l'élève naïf et déçu a mangé une crème brûlée à Zürich. ");
+        const String cjk = String::utf8("敏捷的棕色狐狸跳过了懒狗。素早い茶色の狐がのろまな犬を飛び越える。");
+        const struct { const char* name; String str; } payloads[] = {
+            { "ascii", ascii },
+            { "ascii_long", ascii.repeat(32) },
+            { "latin1", latin1 },
+            { "latin1_long", latin1.repeat(32) },
+            { "cjk", cjk },
+            { "cjk_long", cjk.repeat(32) },
+        };
+
+        for (const auto& payload : payloads)
+        {
+            v8::HandleScope handle_scope(isolate);
+            const v8::Local<v8::String> jstr = impl::Helper::new_string(isolate, payload.str);
+            CHECK(impl::Helper::to_string(isolate, jstr) == payload.str);
+
+            Benchmark::run(vformat("string.gd_to_js.%s", payload.name), Benchmark::kStringIterations, [&](uint64_t n)
+            {
+                for (uint64_t i = 0; i < n; ++i)
+                {
+                    v8::HandleScope loop_scope(isolate);
+                    impl::Helper::new_string(isolate, payload.str);
+                }
+            });
+
+            Benchmark::run(vformat("string.js_to_gd.%s", payload.name), Benchmark::kStringIterations, [&](uint64_t n)
+            {
+                for (uint64_t i = 0; i < n; ++i)
+                {
+                    const String out = impl::Helper::to_string(isolate, jstr);
+                }
+            });
+        }
+    }
+
+    TEST_CASE("[jsb][Benchmark] Containers" * doctest::skip())
+    {
+        GodotJSScriptLanguageIniter initer;
+        std::shared_ptr<Environment> env = GodotJSScriptLanguage::get_singleton()->get_environment();
+
+        // a nested structure of about 1MB in JSON (like save data or a network payload)
+        Benchmark::eval(vformat(R"--(
+(function() {
+const items = [];
+for (let i = 0; i < %d; ++i) {
+    items.push({ id: i, name: "item_" + i, tags: ["common", "rare", "quest"], pos: { x: i * 0.5, y: i * 2 }, flags: { visible: true, locked: false } });
+}
+globalThis.__jsb_bench = { version: 1, items };
+})()
+)--", Benchmark::kContainerItems));
+        MESSAGE("payload size: ", (int64_t) Benchmark::eval_value("JSON.stringify(__jsb_bench).length"));
+
+        {
+            JSB_TESTS_EXECUTION_SCOPE(env.get());
+            v8::Isolate* isolate = env->get_isolate();
+            const v8::Local<v8::Context> context = env->get_context();
+            const v8::Local<v8::Value> data = context->Global()->Get(context, impl::Helper::new_string(isolate, "__jsb_bench")).ToLocalChecked();
+            const v8::Local<v8::Object> json = context->Global()->Get(context, impl::Helper::new_string(isolate, "JSON")).ToLocalChecked().As<v8::Object>();
+            const v8::Local<v8::Function> stringify = json->Get(context, impl::Helper::new_string(isolate, "stringify")).ToLocalChecked().As<v8::Function>();
+
+            Benchmark::run("container.js_to_gd.native", Benchmark::kContainerIterations, [&](uint64_t n)
+            {
+                for (uint64_t i = 0; i < n; ++i)
+                {
+                    v8::HandleScope loop_scope(isolate);
+                    Variant out;
+                    CHECK(TypeConvert::js_to_gd_container(isolate, context, data, out));
+                }
+            });
+
+            Benchmark::run("container.js_to_gd.json", Benchmark::kContainerIterations, [&](uint64_t n)
+            {
+                for (uint64_t i = 0; i < n; ++i)
+                {
+                    v8::HandleScope loop_scope(isolate);
+                    v8::Local<v8::Value> argv[] = { data };
+                    const v8::Local<v8::Value> text = stringify->Call(context, v8::Undefined(isolate), 1, argv).ToLocalChecked();
+                    const Variant out = JSON::parse_string(impl::Helper::to_string(isolate, text));
+                    CHECK(out.get_type() == Variant::DICTIONARY);
+                }
+            });
+        }
+
+        Benchmark::eval("delete globalThis.__jsb_bench;");
+    }
+
+    TEST_CASE("[jsb][Benchmark] Objects" * doctest::skip())
+    {
+        GodotJSScriptLanguageIniter initer;
+
+        Benchmark::eval(R"--(
+(function() {
+const gd = require("godot");
+globalThis.__jsb_bench = {
+    boxed_new(n) { for (let i = 0; i < n; ++i) new gd.Vector2(i, i); },
+    boxed_new_transform(n) { for (let i = 0; i < n; ++i) new gd.Transform3D(); },
+    object_bind(n) { for (let i = 0; i < n; ++i) { const node = new gd.Node(); node.free(); } },
+    refcounted_bind(n) { for (let i = 0; i < n; ++i) new gd.RefCounted(); },
+};
+})()
+)--");
+
+        Benchmark::run("boxed.new.Vector2", Benchmark::kBoxedIterations, [](uint64_t n) { Benchmark::eval(vformat("__jsb_bench.boxed_new(%d)", n)); });
+        Benchmark::run("boxed.new.Transform3D", Benchmark::kBoxedIterations, [](uint64_t n) { Benchmark::eval(vformat("__jsb_bench.boxed_new_transform(%d)", n)); });
+        Benchmark::run("object.bind_unbind.Node", Benchmark::kBindingIterations, [](uint64_t n) { Benchmark::eval(vformat("__jsb_bench.object_bind(%d)", n)); });
+
+        // unbinding happens on GC, include a full collection in the measurement
+        Benchmark::run("object.bind_gc.RefCounted", Benchmark::kBindingIterations, [](uint64_t n)
+        {
+            Benchmark::eval(vformat("__jsb_bench.refcounted_bind(%d)", n));
+            Environment::gc();
+        });
+
+        Benchmark::eval("delete globalThis.__jsb_bench;");
+    }
+
+    TEST_CASE("[jsb][Benchmark] Timers" * doctest::skip())
+    {
+        GodotJSScriptLanguageIniter initer;
+        std::shared_ptr<Environment> env = GodotJSScriptLanguage::get_singleton()->get_environment();
+
+        // schedule n timers and cancel every other one, then wait until the remaining ones fired
+        Benchmark::eval(R"--(
+(function() {
+globalThis.__jsb_bench = {
+    fired: 0,
+    expected: 0,
+    churn(n) {
+        const ids = [];
+        this.fired = 0;
+        this.expected = 0;
+        for (let i = 0; i < n; ++i) ids.push(setTimeout(() => ++this.fired, 0));
+        for (let i = 0; i < n; ++i) {
+            if (i % 2 == 0) ++this.expected; else clearTimeout(ids[i]);
+        }
+    },
+};
+})()
+)--");
+
+        Benchmark::run("timer.churn", Benchmark::kTimerIterations, [&](uint64_t n)
+        {
+            Benchmark::eval(vformat("__jsb_bench.churn(%d)", n));
+            CHECK(Benchmark::wait_until(env, "__jsb_bench.fired == __jsb_bench.expected"));
+        });
+
+        Benchmark::eval("delete globalThis.__jsb_bench;");
+    }
+
+    TEST_CASE("[jsb][Benchmark] SourceMap" * doctest::skip())
+    {
+        static constexpr char kBase64[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+        static constexpr int kMappingsSize = 5 * 1024 * 1024;
+        static constexpr int kFrames = 10000;
+
+        // generate a synthetic `mappings` (about 5MB) with 20 segments per line
+        std::string mappings;
+        mappings.reserve(kMappingsSize + 1024);
+        const auto vlq = [&mappings](int p_value)
+        {
+            uint32_t value = p_value < 0 ? ((uint32_t) -p_value << 1) | 1 : (uint32_t) p_value << 1;
+            do
+            {
+                uint32_t digit = value & 0x1f;
+                value >>= 5;
+                if (value) digit |= 0x20;
+                mappings.push_back(kBase64[digit]);
+            } while (value);
+        };
+        RandomPCG rng(1);
+        int source_column = 0;
+        while (mappings.size() < kMappingsSize)
+        {
+            for (int i = 0; i < 20; ++i)
+            {
+                if (i != 0) mappings.push_back(',');
+                const int column = (int) rng.rand(40);
+                vlq((int) rng.rand(10) + 1);
+                vlq(0);
+                vlq(i == 0 ? 1 : 0);
+                vlq(column - source_column);
+                source_column = column;
+            }
+            mappings.push_back(';');
+        }
+
+        internal::SourceMap map;
+        const uint64_t t0 = OS::get_singleton()->get_ticks_usec();
+        CHECK(map.parse_mappings(mappings.data(), mappings.size()));
+        const uint64_t t1 = OS::get_singleton()->get_ticks_usec();
+        Benchmark::report("sourcemap.parse", 1, t1 - t0);
+
+        internal::IndexedSourcePosition pos;
+        int found = 0;
+        for (int i = 0; i < kFrames; ++i)
+        {
+            found += map.find((int) rng.rand(map.get_line_count()), (int) rng.rand(200), pos);
+        }
+        CHECK(found == kFrames);
+        Benchmark::report("sourcemap.find", kFrames, OS::get_singleton()->get_ticks_usec() - t1);
+    }
+
+    TEST_CASE("[jsb][Benchmark] Modules" * doctest::skip())
+    {
+        GodotJSScriptLanguageIniter initer;
+        std::shared_ptr<Environment> env = GodotJSScriptLanguage::get_singleton()->get_environment();
+
+        // generate distinct modules in the output directory (a search path of the default module resolver),
+        // since loaded modules are cached in the environment.
+        const String dir = internal::PathUtil::combine(internal::Settings::get_jsb_out_res_path(), "jsb_benchmarks");
+        CHECK(DirAccess::make_dir_recursive_absolute(dir) == OK);
+        const uint64_t module_num = Benchmark::kWarmupIterations + Benchmark::kModuleIterations;
+        for (uint64_t i = 0; i < module_num; ++i)
+        {
+            const Ref<FileAccess> file = FileAccess::open(internal::PathUtil::combine(dir, vformat("mod_%d.js", i)), FileAccess::WRITE);
+            REQUIRE(file.is_valid());
+            file->store_string(vformat("exports.value = %d;\nexports.get = function () { return exports.value; };\n", i));
+        }
+
+        uint64_t next_module = 0;
+        Benchmark::run("module.load", Benchmark::kModuleIterations, [&](uint64_t n)
+        {
+            for (uint64_t i = 0; i < n; ++i)
+            {
+                CHECK(env->load(vformat("jsb_benchmarks/mod_%d", next_module++)) == OK);
+            }
+        });
+        Benchmark::remove_dir(dir);
+    }
+
+#if !JSB_WITH_WEB && !JSB_WITH_JAVASCRIPTCORE
+    TEST_CASE("[jsb][Benchmark] Workers" * doctest::skip())
+    {
+        GodotJSScriptLanguageIniter initer;
+        std::shared_ptr<Environment> env = GodotJSScriptLanguage::get_singleton()->get_environment();
+
+        const String dir = internal::PathUtil::combine(internal::Settings::get_jsb_out_res_path(), "jsb_benchmarks");
+        CHECK(DirAccess::make_dir_recursive_absolute(dir) == OK);
+        {
+            const Ref<FileAccess> file = FileAccess::open(internal::PathUtil::combine(dir, "echo_worker.js"), FileAccess::WRITE);
+            REQUIRE(file.is_valid());
+            file->store_string("const { JSWorkerParent } = require(\"godot.worker\");\nJSWorkerParent.onmessage = function (m) { JSWorkerParent.postMessage(m); };\n");
+        }
+
+        Benchmark::eval(R"--(
+(function() {
+const { JSWorker } = require("godot.worker");
+const worker = new JSWorker("jsb_benchmarks/echo_worker");
+globalThis.__jsb_bench = {
+    received: 0,
+    post(n) {
+        this.received = 0;
+        for (let i = 0; i < n; ++i) worker.postMessage({ index: i, text: "ping" });
+    },
+    dispose() { worker.terminate(); },
+};
+worker.onmessage = () => ++globalThis.__jsb_bench.received;
+})()
+)--");
+
+        // wait for the worker to be ready before measuring
+        Benchmark::eval("__jsb_bench.post(1)");
+        REQUIRE(Benchmark::wait_until(env, "__jsb_bench.received == 1"));
+
+        // messages are posted in a burst, since the worker loop sleeps between the updates
+        Benchmark::run("worker.round_trip", Benchmark::kWorkerIterations, [&](uint64_t n)
+        {
+            Benchmark::eval(vformat("__jsb_bench.post(%d)", n));
+            CHECK(Benchmark::wait_until(env, vformat("__jsb_bench.received == %d", n)));
+        });
+
+        Benchmark::eval("__jsb_bench.dispose(); delete globalThis.__jsb_bench;");
+        Benchmark::remove_dir(dir);
+    }
+#endif
+}
+
+#endif
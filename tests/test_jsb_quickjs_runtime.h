@@ -41,6 +41,41 @@ namespace jsb::tests
         JS_FreeContext(ctx);
         JS_FreeRuntime(rt);
     }
+
+    TEST_CASE("[jsb] quickjs.memory_limit")
+    {
+        impl::GlobalInitialize::init();
+        ArrayBufferAllocator allocator;
+        v8::Isolate::CreateParams create_params;
+        create_params.array_buffer_allocator = &allocator;
+
+        v8::Isolate* isolate = v8::Isolate::New(create_params);
+        {
+            v8::HandleScope handle_scope(isolate);
+            const v8::Local<v8::Context> context = v8::Context::New(isolate);
+            const v8::Context::Scope context_scope(context);
+            CHECK(isolate->get_memory_used() > 0);
+
+            isolate->set_memory_limit(isolate->get_memory_used() + 4 * 1024 * 1024);
+            {
+                static constexpr char source[] = "const hog = []; while (true) hog.push(new Array(1024).fill(1));";
+                const impl::TryCatch try_catch(isolate);
+                CHECK(impl::Helper::eval(context, source, ::std::size(source) - 1, "memory_limit.js").IsEmpty());
+                CHECK(try_catch.has_caught());
+            }
+            CHECK(isolate->check_memory_limit_hit());
+            CHECK(!isolate->check_memory_limit_hit());
+
+            // garbage released, it's able to allocate again
+            isolate->set_memory_limit(0);
+            static constexpr char source[] = "new Array(1024).fill(1).length";
+            v8::Local<v8::Value> rval;
+            CHECK(impl::Helper::eval(context, source, ::std::size(source) - 1, "memory_limit.js").ToLocal(&rval));
+            CHECK(rval->IsInt32());
+            CHECK(!isolate->check_memory_limit_hit());
+        }
+        isolate->Dispose();
+    }
 }
 #endif
 
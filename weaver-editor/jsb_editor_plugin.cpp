@@ -404,7 +404,9 @@ void GodotJSEditorPlugin::generate_godot_dts()
     GodotJSScriptLanguage* lang = GodotJSScriptLanguage::get_singleton();
     jsb_check(lang);
     Error err;
-    const String code = jsb_format(R"--((function(){const mod = require("jsb.editor.codegen"); (new mod.TSDCodeGen("%s")).emit();})())--", "./" JSB_TYPE_ROOT);
+    // only the changed d.ts files are rewritten, and the generated code of unchanged classes is reused from the cache
+    const String code = jsb_format(R"--((function(){const mod = require("jsb.editor.codegen"); (new mod.TSDCodeGen("%s", "%s")).emit();})())--",
+        "./" JSB_TYPE_ROOT, jsb::internal::Settings::get_dts_cache_path());
     lang->eval_source(code, err).ignore();
     ERR_FAIL_COND_MSG(err != OK, "failed to evaluate jsb.editor.codegen");
 
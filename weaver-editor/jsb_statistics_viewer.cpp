@@ -48,6 +48,7 @@ void GodotJSStatisticsViewer::on_timer()
 
     jsb::Statistics stats;
     env->get_statistics(stats);
+    lang->get_shadow_environment_stats(stats.shadow_environments);
 
     int index = 0;
     for (const jsb::impl::CustomField& field : stats.custom_fields)
@@ -58,8 +59,38 @@ void GodotJSStatisticsViewer::on_timer()
     add_row(index++, "jsb:native_classes", itos(stats.native_classes));
     add_row(index++, "jsb:script_classes", itos(stats.script_classes));
     add_row(index++, "jsb:cached_string_names", itos(stats.cached_string_names));
+    add_row(index++, "jsb:cached_string_values", jsb_format("%d (%d hits, %d misses)", stats.string_value_cache.entries, stats.string_value_cache.hits, stats.string_value_cache.misses));
+    add_row(index++, "jsb:callable_functions", jsb_format("%d (peak %d, %d deduplicated)", stats.callable_functions.live, stats.callable_functions.peak, stats.callable_functions.dedup_hits));
+    add_row(index++, "jsb:module_fetcher", jsb_format("%d pending (%d fetched)", stats.module_fetcher.pending_requests, stats.module_fetcher.fetched));
+    add_row(index++, "jsb:script_sources", jsb_format("%d (%s, %d pending)", stats.script_sources.files, String::humanize_size(stats.script_sources.bytes), stats.script_sources.pending));
+    add_row(index++, "jsb:script_source_hits", jsb_format("%d hits, %d misses, %d prefetched, %d evicted",
+        stats.script_sources.hits, stats.script_sources.misses, stats.script_sources.prefetched, stats.script_sources.evicted));
     add_row(index++, "jsb:persistent_objects", uitos(stats.persistent_objects));
     add_row(index++, "jsb:allocated_variants", uitos(stats.allocated_variants));
+    add_row(index++, "jsb:dropped_logs", uitos(stats.dropped_logs));
+    add_row(index++, "jsb:array_buffer_pooled", String::humanize_size(stats.array_buffer_pooled_bytes));
+    add_row(index++, "jsb:array_buffer_outstanding", String::humanize_size(stats.array_buffer_outstanding_bytes));
+    add_row(index++, "jsb:memory_used", String::humanize_size(stats.memory_used));
+    add_row(index++, "jsb:memory_pressure", jsb::MemoryPressureLevel::get_name((jsb::MemoryPressureLevel::Type) stats.memory_pressure_level));
+    add_row(index++, "jsb:shadow_environments", jsb_format("%d idle, %d in use", stats.shadow_environments.idle, stats.shadow_environments.in_use));
+    add_row(index++, "jsb:shadow_environment_hits", jsb_format("%d hits, %d misses, %d prewarmed, %d disposed",
+        stats.shadow_environments.hits, stats.shadow_environments.misses, stats.shadow_environments.prewarmed, stats.shadow_environments.disposed));
+#if JSB_WITH_BRIDGE_COUNTERS
+    // bridge traffic per frame
+    for (int i = 0; i < jsb::BridgeCounters::CrossingNum; ++i)
+    {
+        add_row(index++, jsb_format("bridge:%s", jsb::BridgeCounters::get_crossing_name((jsb::BridgeCounters::Crossing) i)), uitos(stats.bridge_last_frame.crossings[i]));
+    }
+    for (int i = 0; i < Variant::VARIANT_MAX; ++i)
+    {
+        const uint64_t js_to_gd = stats.bridge_last_frame.js_to_gd[i];
+        const uint64_t gd_to_js = stats.bridge_last_frame.gd_to_js[i];
+        if (js_to_gd == 0 && gd_to_js == 0) continue;
+        // NIL means the conversions without an expected type
+        const String type_name = i == Variant::NIL ? String("Variant") : Variant::get_type_name((Variant::Type) i);
+        add_row(index++, jsb_format("bridge:convert:%s", type_name), jsb_format("js->gd %d, gd->js %d", js_to_gd, gd_to_js));
+    }
+#endif
     for (; index < tree_root->get_child_count(); ++index)
     {
         tree_root->get_child(index)->set_visible(false);
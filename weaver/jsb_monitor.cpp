@@ -17,6 +17,27 @@
         return stats_.MonitorName;\
     }
 
+#define JSB_DEFINE_BRIDGE_MONITOR(MonitorName, Accessor) \
+    Variant GodotJSMonitor::get_value_ ## MonitorName()\
+    {\
+        flush();\
+        return stats_.bridge_last_frame.Accessor;\
+    }
+
+#define JSB_DEFINE_FUNCTION_REGISTRY_MONITOR(MonitorName, Accessor) \
+    Variant GodotJSMonitor::get_value_ ## MonitorName()\
+    {\
+        flush();\
+        return stats_.callable_functions.Accessor;\
+    }
+
+#define JSB_DEFINE_SHADOW_MONITOR(MonitorName, Accessor) \
+    Variant GodotJSMonitor::get_value_ ## MonitorName()\
+    {\
+        flush();\
+        return stats_.shadow_environments.Accessor;\
+    }
+
 #define JSB_DEFINE_CUSTOM_MONITOR(MonitorName, Accessor) \
     Variant GodotJSMonitor::get_value_ ## MonitorName()\
     {\
@@ -31,7 +52,24 @@ GodotJSMonitor::GodotJSMonitor()
     JSB_NEW_MONITOR(script_classes);
     JSB_NEW_MONITOR(cached_string_names);
     JSB_NEW_MONITOR(persistent_objects);
+    JSB_NEW_MONITOR(callable_functions);
+    JSB_NEW_MONITOR(callable_functions_peak);
     JSB_NEW_MONITOR(allocated_variants);
+    JSB_NEW_MONITOR(dropped_logs);
+    JSB_NEW_MONITOR(array_buffer_pooled_bytes);
+    JSB_NEW_MONITOR(array_buffer_outstanding_bytes);
+    JSB_NEW_MONITOR(memory_used);
+    JSB_NEW_MONITOR(shadow_environments_idle);
+    JSB_NEW_MONITOR(shadow_environments_in_use);
+    JSB_NEW_MONITOR(shadow_environment_hits);
+    JSB_NEW_MONITOR(shadow_environment_misses);
+    JSB_NEW_MONITOR(object_method_calls);
+    JSB_NEW_MONITOR(builtin_function_calls);
+    JSB_NEW_MONITOR(script_method_calls);
+    JSB_NEW_MONITOR(callable_calls);
+    JSB_NEW_MONITOR(variant_allocs);
+    JSB_NEW_MONITOR(js_to_gd_conversions);
+    JSB_NEW_MONITOR(gd_to_js_conversions);
 #if JSB_WITH_V8
     JSB_NEW_MONITOR(heap_size);
 #elif JSB_WITH_QUICKJS
@@ -46,7 +84,24 @@ void GodotJSMonitor::_bind_methods()
     JSB_BIND_MONITOR(script_classes);
     JSB_BIND_MONITOR(cached_string_names);
     JSB_BIND_MONITOR(persistent_objects);
+    JSB_BIND_MONITOR(callable_functions);
+    JSB_BIND_MONITOR(callable_functions_peak);
     JSB_BIND_MONITOR(allocated_variants);
+    JSB_BIND_MONITOR(dropped_logs);
+    JSB_BIND_MONITOR(array_buffer_pooled_bytes);
+    JSB_BIND_MONITOR(array_buffer_outstanding_bytes);
+    JSB_BIND_MONITOR(memory_used);
+    JSB_BIND_MONITOR(shadow_environments_idle);
+    JSB_BIND_MONITOR(shadow_environments_in_use);
+    JSB_BIND_MONITOR(shadow_environment_hits);
+    JSB_BIND_MONITOR(shadow_environment_misses);
+    JSB_BIND_MONITOR(object_method_calls);
+    JSB_BIND_MONITOR(builtin_function_calls);
+    JSB_BIND_MONITOR(script_method_calls);
+    JSB_BIND_MONITOR(callable_calls);
+    JSB_BIND_MONITOR(variant_allocs);
+    JSB_BIND_MONITOR(js_to_gd_conversions);
+    JSB_BIND_MONITOR(gd_to_js_conversions);
 #if JSB_WITH_V8
     JSB_BIND_MONITOR(heap_size);
 #elif JSB_WITH_QUICKJS
@@ -59,7 +114,24 @@ JSB_DEFINE_MONITOR(native_classes);
 JSB_DEFINE_MONITOR(script_classes);
 JSB_DEFINE_MONITOR(cached_string_names);
 JSB_DEFINE_MONITOR(persistent_objects);
+JSB_DEFINE_FUNCTION_REGISTRY_MONITOR(callable_functions, live);
+JSB_DEFINE_FUNCTION_REGISTRY_MONITOR(callable_functions_peak, peak);
 JSB_DEFINE_MONITOR(allocated_variants);
+JSB_DEFINE_MONITOR(dropped_logs);
+JSB_DEFINE_MONITOR(array_buffer_pooled_bytes);
+JSB_DEFINE_MONITOR(array_buffer_outstanding_bytes);
+JSB_DEFINE_MONITOR(memory_used);
+JSB_DEFINE_SHADOW_MONITOR(shadow_environments_idle, idle);
+JSB_DEFINE_SHADOW_MONITOR(shadow_environments_in_use, in_use);
+JSB_DEFINE_SHADOW_MONITOR(shadow_environment_hits, hits);
+JSB_DEFINE_SHADOW_MONITOR(shadow_environment_misses, misses);
+JSB_DEFINE_BRIDGE_MONITOR(object_method_calls, crossings[jsb::BridgeCounters::ObjectMethodCall]);
+JSB_DEFINE_BRIDGE_MONITOR(builtin_function_calls, crossings[jsb::BridgeCounters::BuiltinFunctionCall]);
+JSB_DEFINE_BRIDGE_MONITOR(script_method_calls, crossings[jsb::BridgeCounters::ScriptMethodCall]);
+JSB_DEFINE_BRIDGE_MONITOR(callable_calls, crossings[jsb::BridgeCounters::CallableCall]);
+JSB_DEFINE_BRIDGE_MONITOR(variant_allocs, crossings[jsb::BridgeCounters::VariantAlloc]);
+JSB_DEFINE_BRIDGE_MONITOR(js_to_gd_conversions, get_js_to_gd_num());
+JSB_DEFINE_BRIDGE_MONITOR(gd_to_js_conversions, get_gd_to_js_num());
 
 #if JSB_WITH_V8
     JSB_DEFINE_CUSTOM_MONITOR(heap_size, u.u64_cap[0]);
@@ -89,4 +161,5 @@ void GodotJSMonitor::flush()
     const std::shared_ptr<jsb::Environment> env = lang->get_environment();
     if (!env) return;
     env->get_statistics(stats_);
+    lang->get_shadow_environment_stats(stats_.shadow_environments);
 }
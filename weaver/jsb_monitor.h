@@ -25,7 +25,28 @@ protected:
     JSB_DECLARE_MONITOR(script_classes);
     JSB_DECLARE_MONITOR(cached_string_names);
     JSB_DECLARE_MONITOR(persistent_objects);
+    JSB_DECLARE_MONITOR(callable_functions);
+    JSB_DECLARE_MONITOR(callable_functions_peak);
     JSB_DECLARE_MONITOR(allocated_variants);
+    JSB_DECLARE_MONITOR(dropped_logs);
+    JSB_DECLARE_MONITOR(array_buffer_pooled_bytes);
+    JSB_DECLARE_MONITOR(array_buffer_outstanding_bytes);
+    JSB_DECLARE_MONITOR(memory_used);
+
+    // shadow environment pool
+    JSB_DECLARE_MONITOR(shadow_environments_idle);
+    JSB_DECLARE_MONITOR(shadow_environments_in_use);
+    JSB_DECLARE_MONITOR(shadow_environment_hits);
+    JSB_DECLARE_MONITOR(shadow_environment_misses);
+
+    // bridge traffic per frame
+    JSB_DECLARE_MONITOR(object_method_calls);
+    JSB_DECLARE_MONITOR(builtin_function_calls);
+    JSB_DECLARE_MONITOR(script_method_calls);
+    JSB_DECLARE_MONITOR(callable_calls);
+    JSB_DECLARE_MONITOR(variant_allocs);
+    JSB_DECLARE_MONITOR(js_to_gd_conversions);
+    JSB_DECLARE_MONITOR(gd_to_js_conversions);
 
 #if JSB_WITH_V8
     JSB_DECLARE_MONITOR(heap_size);
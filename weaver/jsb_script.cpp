@@ -228,13 +228,17 @@ Error GodotJSScript::reload(bool p_keep_state)
     jsb::JSEnvironment env(get_path(), true);
 
     //TODO different env has different module state, we need to refresh the state in all envs when marking a module as dirty somewhere
-    const jsb::ModuleReloadResult::Type result = env->mark_as_reloading(module_id);
+    Vector<StringName> dependents;
+    const jsb::ModuleReloadResult::Type result = env->mark_as_reloading(module_id, &dependents);
     if (result == jsb::ModuleReloadResult::Requested)
     {
         //TODO `Callable` objects bound with this script should be invalidated somehow?
         // ...
 
         loaded_ = false;
+
+        // scripts importing this one are re-executed too, their instances will be rebound on the next `ensure_module_loaded`
+        invalidate_dependent_scripts(env->get_module_cache(), dependents, this);
     }
     else if (result != jsb::ModuleReloadResult::NoChanges)
     {
@@ -244,6 +248,21 @@ Error GodotJSScript::reload(bool p_keep_state)
     return OK;
 }
 
+void GodotJSScript::invalidate_dependent_scripts(const jsb::JavaScriptModuleCache& p_module_cache, const Vector<StringName>& p_dependents, const GodotJSScript* p_except)
+{
+    for (const StringName& dependent_id : p_dependents)
+    {
+        const jsb::JavaScriptModule* dependent = p_module_cache.find(dependent_id);
+        if (!dependent || !dependent->script_class_id) continue;
+        const Ref<GodotJSScript> dependent_script = ::ResourceCache::get_ref(jsb::internal::PathUtil::convert_javascript_path(dependent->source_info.source_filepath));
+        if (dependent_script.is_valid() && dependent_script.ptr() != p_except)
+        {
+            JSB_LOG(Verbose, "script %s is invalidated as a dependent", dependent_script->get_path());
+            dependent_script->loaded_ = false;
+        }
+    }
+}
+
 #ifdef TOOLS_ENABLED
 #if GODOT_4_4_OR_NEWER
 StringName GodotJSScript::get_doc_class_name() const
@@ -50,6 +50,13 @@ private:
     jsb_force_inline bool _is_valid() const { return jsb::internal::VariantUtil::is_valid_name(script_class_info_.module_id); }
 
     void _update_exports(PlaceHolderScriptInstance *p_instance_to_update, bool p_base_exports_changed = false);
+
+public:
+    // invalidate the scripts of the given (reloading) modules, they will be loaded again on the next `ensure_module_loaded`.
+    // modules not attached with a script are ignored.
+    static void invalidate_dependent_scripts(const jsb::JavaScriptModuleCache& p_module_cache, const Vector<StringName>& p_dependents, const GodotJSScript* p_except = nullptr);
+
+private:
     void _update_exports_values(List<PropertyInfo>& r_props, HashMap<StringName, Variant>& r_values);
 
 public:
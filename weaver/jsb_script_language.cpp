@@ -1,18 +1,22 @@
 #include "jsb_script_language.h"
 
 #include <iterator>
+#include <algorithm>
 
 #include "jsb_monitor.h"
 #include "../jsb_project_preset.h"
 #include "../internal/jsb_internal.h"
+#include "../internal/jsb_thread_util.h"
 #include "../bridge/jsb_worker.h"
+#include "../bridge/jsb_object_binding_metadata.h"
+#include "../bridge/jsb_json_module_cache.h"
 
 #include "jsb_script.h"
 
+#include "core/extension/gdextension_manager.h"
 #include "editor/editor_settings.h"
 #include "main/performance.h"
 
-#include "modules/regex/regex.h"
 
 #ifdef TOOLS_ENABLED
 #include "../weaver-editor/templates/templates.gen.h"
@@ -58,13 +62,34 @@ GodotJSScriptLanguage::GodotJSScriptLanguage()
     JSB_BENCHMARK_SCOPE(GodotJSScriptLanguage, Construct);
     jsb_check(!singleton_);
     singleton_ = this;
-    js_class_name_matcher1_ = RegEx::create_from_string(R"(\s*exports.default\s*=\s*class\s*(\w+)\s*extends\s*(\w+)\s*\{?)");
-    js_class_name_matcher2_ = RegEx::create_from_string(R"(\s*exports.default\s*=\s*(\w+)\s*;?)");
-    ts_class_name_matcher_ = RegEx::create_from_string(R"(\s*export\s+default\s+class\s+(\w+)\s+extends\s+(\w+))");
-    ts_class_name_tool_matcher_ = RegEx::create_from_string(R"(\s*@tool\s*\(\s*\)\s*\n*\s*export\s+default\s+class\s+(\w+)\s+extends\s+(\w+))");
     jsb::internal::StringNames::create();
 }
 
+namespace
+{
+    // the binding metadata of extension classes refers to the MethodBinds owned by the extensions
+    void _connect_extension_signals(bool p_connect)
+    {
+        GDExtensionManager* extension_manager = GDExtensionManager::get_singleton();
+        if (!extension_manager) return;
+
+        const Callable on_reloaded = callable_mp_static(&jsb::ObjectBindingMetadata::clear_extension_classes);
+#if GODOT_4_3_OR_NEWER
+        const Callable on_changed = on_reloaded.unbind(1);
+        const StringName signals[] = { "extensions_reloaded", "extension_loaded", "extension_unloading" };
+        const Callable callables[] = { on_reloaded, on_changed, on_changed };
+#else
+        const StringName signals[] = { "extensions_reloaded" };
+        const Callable callables[] = { on_reloaded };
+#endif
+        for (int index = 0; index < (int) ::std::size(signals); ++index)
+        {
+            if (p_connect) extension_manager->connect(signals[index], callables[index]);
+            else if (extension_manager->is_connected(signals[index], callables[index])) extension_manager->disconnect(signals[index], callables[index]);
+        }
+    }
+}
+
 GodotJSScriptLanguage::~GodotJSScriptLanguage()
 {
     jsb::internal::StringNames::free();
@@ -94,17 +119,38 @@ void GodotJSScriptLanguage::init()
     params.initial_script_slots = JSB_MASTER_INITIAL_SCRIPT_SLOTS;
     params.debugger_port = jsb::internal::Settings::get_debugger_port();
     params.thread_id = Thread::get_caller_id();
+    params.memory_budget.soft_limit = jsb::internal::Settings::get_memory_soft_limit();
+    params.memory_budget.hard_limit = jsb::internal::Settings::get_memory_hard_limit();
 
     // main environment
     environment_ = std::make_shared<jsb::Environment>(params);
     environment_->init();
 
+    if (Engine::get_singleton()->is_editor_hint())
+    {
+        global_class_index_.load(jsb::internal::Settings::get_global_class_index_path());
+    }
+
     if (const String entry_script_path = jsb::internal::Settings::get_entry_script_path();
         !entry_script_path.is_empty())
     {
         environment_->load(entry_script_path);
     }
 
+    _connect_extension_signals(true);
+
+    shadow_stats_ = {};
+    shadow_pool_size_ = jsb::internal::Settings::get_shadow_environment_pool_size();
+    shadow_prewarm_num_ = jsb::internal::Settings::get_shadow_environment_prewarm_num();
+    if (shadow_prewarm_num_ > 0)
+    {
+        shadow_prewarm_interrupted_.clear();
+        Thread::Settings settings;
+        settings.priority = Thread::PRIORITY_LOW;
+        shadow_prewarm_thread_.start(_shadow_prewarm_run, this, settings);
+        request_shadow_prewarm();
+    }
+
 #if JSB_DEBUG
     if (jsb::compat::Performance::get_singleton()) monitor_ = memnew(GodotJSMonitor);
 #endif
@@ -122,18 +168,47 @@ void GodotJSScriptLanguage::finish()
 #if !JSB_WITH_WEB && !JSB_WITH_JAVASCRIPTCORE
     jsb::Worker::finish();
 #endif
+    if (shadow_prewarm_thread_.is_started())
+    {
+        shadow_prewarm_interrupted_.set();
+        shadow_prewarm_semaphore_.post();
+        shadow_prewarm_thread_.wait_to_finish();
+    }
     {
         std::vector<ShadowEnvironment> shadow_environments;
+        std::vector<std::shared_ptr<jsb::Environment>> retired_environments;
         {
             MutexLock shadow_lock(shadow_mutex_);
             shadow_environments = shadow_environments_;
             shadow_environments_.clear();
+            retired_environments.swap(retired_shadow_environments_);
         }
         for (const ShadowEnvironment& env : shadow_environments)
         {
             env.holder->dispose();
         }
+        for (const std::shared_ptr<jsb::Environment>& env : retired_environments)
+        {
+            env->dispose();
+        }
+    }
+    if (profile_info_map_.enabled)
+    {
+        profile_info_map_.enabled = false;
+        jsb::internal::CallProfiler::release();
+    }
+    jsb::internal::CallProfiler::shutdown();
+    jsb::internal::AsyncLogger::shutdown();
+    jsb::internal::FileManager::shutdown();
+    jsb::JsonModuleCache::clear();
+    if (Engine::get_singleton()->is_editor_hint())
+    {
+        global_class_index_.save(jsb::internal::Settings::get_global_class_index_path());
     }
+
+    // ClassDB may change before the next init (e.g. extensions reloaded)
+    _connect_extension_signals(false);
+    jsb::ObjectBindingMetadata::clear();
     JSB_LOG(VeryVerbose, "jsb lang finish");
 }
 
@@ -144,25 +219,56 @@ void GodotJSScriptLanguage::frame()
 
     last_ticks_ = base_ticks;
     environment_->update(elapsed_milli);
+    collect_profile_events();
 
-#if JSB_DEBUG
+    if (Engine::get_singleton()->is_editor_hint() && base_ticks / 1000ULL - global_class_index_saved_msec_ >= JSB_GLOBAL_CLASS_INDEX_SAVE_INTERVAL
+        && global_class_index_.is_dirty())
     {
-        MutexLock lock(mutex_);
-        if (profile_info_map_.enabled)
+        global_class_index_saved_msec_ = base_ticks / 1000ULL;
+        global_class_index_.save(jsb::internal::Settings::get_global_class_index_path());
+    }
+}
+
+void GodotJSScriptLanguage::collect_profile_events()
+{
+    if (!jsb::internal::CallProfiler::is_enabled())
+    {
+        return;
+    }
+
+    jsb::internal::CallProfiler::collect(profile_events_);
+
+    MutexLock lock(mutex_);
+    if (profile_info_map_.enabled)
+    {
+        // we only collect GodotJSScriptInstance function profiling data instead of the deep profiling data from JS runtime.
+        // please use Chrome DevTools for deep JS profiling.
+        for (const jsb::internal::CallProfiler::Event& event : profile_events_)
+        {
+            if (event.kind != jsb::internal::CallProfiler::ScriptCall) continue;
+
+            const uint64_t time = event.end_usec - event.begin_usec;
+            ScriptClassProfileInfo& prof = profile_info_map_.classes[event.class_name];
+            prof.path = event.source;
+            ScriptCallProfileInfo& method_prof = prof.methods[event.name];
+            method_prof.frame_calls++;
+            method_prof.frame_time += time;
+            method_prof.total_calls++;
+            method_prof.total_time += time;
+        }
+
+        for (auto& class_kv : profile_info_map_.classes)
         {
-            for (auto& class_kv : profile_info_map_.classes)
+            for (auto& method_kv : class_kv.value.methods)
             {
-                for (auto& method_kv : class_kv.value.methods)
-                {
-                    method_kv.value.last_frame_calls = method_kv.value.frame_calls;
-                    method_kv.value.last_frame_time = method_kv.value.frame_time;
-                    method_kv.value.frame_calls = 0;
-                    method_kv.value.frame_time = 0;
-                }
+                method_kv.value.last_frame_calls = method_kv.value.frame_calls;
+                method_kv.value.last_frame_time = method_kv.value.frame_time;
+                method_kv.value.frame_calls = 0;
+                method_kv.value.frame_time = 0;
             }
         }
     }
-#endif
+    profile_events_.clear();
 }
 
 void GodotJSScriptLanguage::get_reserved_words(List<String>* p_words) const
@@ -312,82 +418,25 @@ String GodotJSScriptLanguage::get_global_class_name(const String& p_path, String
 {
     // GodotJSScript implementation do not really support threaded access for now.
     // So, we can not load the script module in-place because `get_global_class_name` could be called from EditorFileSystem (background) scan.
-    // And for simplicity, we use regex to extract the class name from the source code instead of using ANTLR or similar.
-    // Please follow the rules of the class name declaration in the source code.
-    //     * .ts files: `export default class ClassName extends BaseClassName`
-    //     * .js files: `class ClassName extends BaseClassName` and `exports.default = ClassName` (with or without `;`)
+    // And for simplicity, we use a lightweight tokenizer to extract the class name from the source code instead of using ANTLR or similar.
+    // Please follow the rules of the class name declaration in the source code (see `GlobalClassIndex::parse`).
+    // The results are indexed by the modified time and the content hash of files, unchanged files are not parsed again.
 
     // And, we do not support `r_is_abstract` here, please define all abstract class by not exporting it as `default`.
     // It should be equivalent and enough for TS/JS since we do not rely on GodotJSScript to use abstract classes in TS/JS sources.
 
-    Error err;
-    const Ref<FileAccess> file_access = FileAccess::open(p_path, FileAccess::READ, &err);
-    if (err)
+    jsb::internal::GlobalClassInfo info;
+    if (!global_class_index_.get(p_path, info) || info.class_name.is_empty())
     {
         return String();
     }
 
-    const String source = file_access->get_as_utf8_string();
-    if (jsb::internal::PathUtil::is_recognized_javascript_extension(p_path))
-    {
-        // check if the class id defined in a single line (export default class ClassName extends BaseClassName)
-        jsb_check(!js_class_name_matcher1_.is_null());
-        const Ref<RegExMatch> match1 = js_class_name_matcher1_->search(source);
-        if (match1.is_valid() && match1->get_group_count() == 2)
-        {
-            const String class_name = match1->get_string(1);
-            if (r_base_type) *r_base_type = match1->get_string(2);
-            return class_name;
-        }
-
-        // otherwise, it probably defined in separated lines (firstly, check 'class ClassName extends BaseClassName')
-        jsb_check(!js_class_name_matcher2_.is_null());
-        const Ref<RegExMatch> match2 = js_class_name_matcher2_->search(source);
-        if (match2.is_valid() && match2->get_group_count() == 1)
-        {
-            const String class_name = match2->get_string(1);
-            if (r_base_type)
-            {
-                // then, check 'exports.default = ClassName'
-                const Ref<RegEx> base_matcher = RegEx::create_from_string(jsb::internal::format(R"(\s*class\s*%s\s*extends\s*(\w+)\s*\{?)", class_name));
-                const Ref<RegExMatch> base_match = base_matcher->search(source);
-                if (base_match.is_valid() && base_match->get_group_count() == 1)
-                {
-                    *r_base_type = base_match->get_string(1);
-                }
-            }
-            return class_name;
-        }
-    }
-    else
-    {
-        // hope it's a typescript file
-        jsb_check(!ts_class_name_matcher_.is_null());
-        jsb_check(!ts_class_name_tool_matcher_.is_null());
-
-        // check if it's a tool script (`@tool \n export default class ClassName extends BaseName { `)
-        Ref<RegExMatch> match =  ts_class_name_tool_matcher_->search(source);
-        if (match.is_valid() && match->get_group_count() == 2)
-        {
+    if (r_base_type) *r_base_type = info.base_type;
+    if (r_icon_path && !info.icon_path.is_empty()) *r_icon_path = info.icon_path;
 #if GODOT_4_4_OR_NEWER
-            if (r_is_tool) *r_is_tool = true;
+    if (r_is_tool && info.is_tool) *r_is_tool = true;
 #endif
-        }
-        else
-        {
-            // check if it's a normal script (without `@tool`)
-            match = ts_class_name_matcher_->search(source);
-            if (!match.is_valid() || match->get_group_count() != 2)
-            {
-                return {};
-            }
-        }
-
-        const String class_name = match->get_string(1);
-        if (r_base_type) *r_base_type = match->get_string(2);
-        return class_name;
-    }
-    return {};
+    return info.class_name;
 }
 
 bool GodotJSScriptLanguage::handles_global_class_type(const String& p_type) const
@@ -407,7 +456,10 @@ String GodotJSScriptLanguage::get_type() const
 
 void GodotJSScriptLanguage::scan_external_changes()
 {
-    environment_->scan_external_changes();
+    // scripts importing the changed modules are stale too (the same way as `GodotJSScript::reload`)
+    Vector<StringName> script_dependents;
+    environment_->scan_external_changes(&script_dependents);
+    GodotJSScript::invalidate_dependent_scripts(environment_->get_module_cache(), script_dependents);
 
 #ifdef TOOLS_ENABLED
     // fix scripts with no .js counterpart found (only missing scripts)
@@ -439,36 +491,18 @@ void GodotJSScriptLanguage::thread_exit()
 
 void GodotJSScriptLanguage::profiling_start()
 {
-#if JSB_DEBUG
     MutexLock lock(mutex_);
+    if (profile_info_map_.enabled) return;
     profile_info_map_.enabled = true;
-#endif
+    jsb::internal::CallProfiler::acquire();
 }
 
 void GodotJSScriptLanguage::profiling_stop()
 {
-#if JSB_DEBUG
-    MutexLock lock(mutex_);
-    profile_info_map_.enabled = false;
-#endif
-}
-
-void GodotJSScriptLanguage::add_script_call_profile_info(const String& p_path, const StringName& p_class, const StringName& p_method, uint64_t p_time)
-{
-    // we only collect GodotJSScriptInstance function profiling data instead of the deep profiling data from JS runtime.
-    // please use Chrome DevTools for deep JS profiling.
-
-#if JSB_DEBUG
     MutexLock lock(mutex_);
     if (!profile_info_map_.enabled) return;
-
-    ScriptClassProfileInfo& prof = profile_info_map_.classes[p_class];
-    prof.path = p_path;
-    prof.methods[p_method].frame_calls++;
-    prof.methods[p_method].frame_time += p_time;
-    prof.methods[p_method].total_calls++;
-    prof.methods[p_method].total_time += p_time;
-#endif
+    profile_info_map_.enabled = false;
+    jsb::internal::CallProfiler::release();
 }
 
 namespace
@@ -482,7 +516,6 @@ namespace
 
 int GodotJSScriptLanguage::profiling_get_accumulated_data(ProfilingInfo* p_info_arr, int p_info_max)
 {
-#if JSB_DEBUG
     MutexLock lock(mutex_);
     if (!profile_info_map_.enabled) return 0;
 
@@ -503,14 +536,10 @@ int GodotJSScriptLanguage::profiling_get_accumulated_data(ProfilingInfo* p_info_
         }
     }
     return current;
-#else
-    return 0;
-#endif
 }
 
 int GodotJSScriptLanguage::profiling_get_frame_data(ProfilingInfo* p_info_arr, int p_info_max)
 {
-#if JSB_DEBUG
     MutexLock lock(mutex_);
     if (!profile_info_map_.enabled) return 0;
 
@@ -531,9 +560,24 @@ int GodotJSScriptLanguage::profiling_get_frame_data(ProfilingInfo* p_info_arr, i
         }
     }
     return current;
-#else
-    return 0;
-#endif
+}
+
+std::shared_ptr<jsb::Environment> GodotJSScriptLanguage::new_shadow_environment() const
+{
+    jsb::Environment::CreateParams params;
+    params.initial_class_slots = 128;
+    params.initial_object_slots = 512;
+    params.initial_script_slots = 32;
+    params.type = jsb::Environment::Type::Shadow;
+    params.thread_id = Thread::UNASSIGNED_ID;
+
+    std::shared_ptr<jsb::Environment> env = std::make_shared<jsb::Environment>(params);
+    JSB_LOG(Log, "creating a shadow Environment on thread %d for %s [env %s]",
+        Thread::get_caller_id(),
+        jsb_typename(GodotJSScript),
+        (uintptr_t) env->id());
+    env->init();
+    return env;
 }
 
 std::shared_ptr<jsb::Environment> GodotJSScriptLanguage::create_shadow_environment()
@@ -542,29 +586,31 @@ std::shared_ptr<jsb::Environment> GodotJSScriptLanguage::create_shadow_environme
     {
         MutexLock shadow_lock(shadow_mutex_);
 
+        // reentered on the same thread
         for (ShadowEnvironment& shadow : shadow_environments_)
         {
-            if (shadow.rc == 0 || shadow.thread_id == caller_id)
+            if (shadow.rc != 0 && shadow.thread_id == caller_id)
             {
                 shadow.rc++;
                 return shadow.holder;
             }
         }
-    }
 
-    jsb::Environment::CreateParams params;
-    params.initial_class_slots = 128;
-    params.initial_object_slots = 512;
-    params.initial_script_slots = 32;
-    params.type = jsb::Environment::Type::Shadow;
-    params.thread_id = Thread::UNASSIGNED_ID;
+        for (ShadowEnvironment& shadow : shadow_environments_)
+        {
+            if (shadow.rc == 0)
+            {
+                shadow.rc = 1;
+                shadow.thread_id = caller_id;
+                ++shadow_stats_.hits;
+                request_shadow_prewarm();
+                return shadow.holder;
+            }
+        }
+        ++shadow_stats_.misses;
+    }
 
-    std::shared_ptr<jsb::Environment> env = std::make_shared<jsb::Environment>(params);
-    JSB_LOG(Log, "creating a shadow Environment on thread %d for %s [env %s]",
-        Thread::get_caller_id(),
-        jsb_typename(GodotJSScript),
-        (uintptr_t) env->id());
-    env->init();
+    std::shared_ptr<jsb::Environment> env = new_shadow_environment();
     {
         MutexLock shadow_lock(shadow_mutex_);
         shadow_environments_.push_back({caller_id, env, 1});
@@ -574,27 +620,119 @@ std::shared_ptr<jsb::Environment> GodotJSScriptLanguage::create_shadow_environme
 
 void GodotJSScriptLanguage::destroy_shadow_environment(const std::shared_ptr<jsb::Environment>& p_env)
 {
-    bool found = false;
+    {
+        MutexLock shadow_lock(shadow_mutex_);
+        const auto it = std::find_if(shadow_environments_.begin(), shadow_environments_.end(),
+            [&](const ShadowEnvironment& shadow) { return shadow.holder == p_env; });
+        jsb_ensuref(it != shadow_environments_.end(), "not a registered shadow environment");
+        if (it->rc > 1)
+        {
+            --it->rc;
+            return;
+        }
+    }
+
+    // the global object, module cache and script classes can not be reset in place.
+    // if prewarming is enabled, the environments which have run user code are replaced by fresh ones to avoid leaking states into the next user,
+    // and they are disposed on the prewarm thread instead of the loader thread.
+    // otherwise, they are reused as is.
+    const bool should_retire = shadow_prewarm_num_ > 0 && p_env->has_run_user_code();
+
+    // the last reference, it's still exclusively held by the current thread while recycling
+    if (!should_retire) p_env->recycle();
+
     bool should_dispose = false;
     {
         MutexLock shadow_lock(shadow_mutex_);
-        const size_t num = shadow_environments_.size();
-        for (auto it = shadow_environments_.begin();
-            it != shadow_environments_.end();
-            ++it)
+        int idle_num = 0;
+        for (const ShadowEnvironment& shadow : shadow_environments_)
+        {
+            if (shadow.rc == 0) ++idle_num;
+        }
+
+        const auto it = std::find_if(shadow_environments_.begin(), shadow_environments_.end(),
+            [&](const ShadowEnvironment& shadow) { return shadow.holder == p_env; });
+        jsb_check(it != shadow_environments_.end());
+        if (--it->rc == 0)
+        {
+            it->thread_id = Thread::UNASSIGNED_ID;
+            if (should_retire)
+            {
+                ++shadow_stats_.disposed;
+                shadow_environments_.erase(it);
+                retired_shadow_environments_.push_back(p_env);
+                request_shadow_prewarm();
+            }
+            else if (idle_num >= shadow_pool_size_)
+            {
+                should_dispose = true;
+                ++shadow_stats_.disposed;
+                shadow_environments_.erase(it);
+            }
+        }
+    }
+    if (should_dispose) p_env->dispose();
+}
+
+void GodotJSScriptLanguage::get_shadow_environment_stats(jsb::ShadowEnvironmentStats& r_stats) const
+{
+    MutexLock shadow_lock(shadow_mutex_);
+    r_stats = shadow_stats_;
+    r_stats.idle = 0;
+    r_stats.in_use = 0;
+    for (const ShadowEnvironment& shadow : shadow_environments_)
+    {
+        if (shadow.rc == 0) ++r_stats.idle;
+        else ++r_stats.in_use;
+    }
+}
+
+void GodotJSScriptLanguage::request_shadow_prewarm()
+{
+    if (shadow_prewarm_num_ > 0)
+    {
+        shadow_prewarm_semaphore_.post();
+    }
+}
+
+void GodotJSScriptLanguage::_shadow_prewarm_run(void* p_data)
+{
+    GodotJSScriptLanguage* self = (GodotJSScriptLanguage*) p_data;
+    jsb::internal::ThreadUtil::set_name("JSShadowPrewarm");
+    while (true)
+    {
+        self->shadow_prewarm_semaphore_.wait();
         {
-            if (it->holder == p_env)
+            std::vector<std::shared_ptr<jsb::Environment>> retired_environments;
             {
-                found = true;
-                if (--it->rc == 0 && num > JSB_MAX_CACHED_SHADOW_ENVIRONMENTS)
+                MutexLock shadow_lock(self->shadow_mutex_);
+                retired_environments.swap(self->retired_shadow_environments_);
+            }
+            for (const std::shared_ptr<jsb::Environment>& env : retired_environments)
+            {
+                env->dispose();
+            }
+        }
+        while (!self->shadow_prewarm_interrupted_.is_set())
+        {
+            {
+                MutexLock shadow_lock(self->shadow_mutex_);
+                int idle_num = 0;
+                for (const ShadowEnvironment& shadow : self->shadow_environments_)
                 {
-                    should_dispose = true;
-                    shadow_environments_.erase(it);
+                    if (shadow.rc == 0) ++idle_num;
                 }
-                break;
+                if (idle_num >= self->shadow_prewarm_num_) break;
             }
+
+            std::shared_ptr<jsb::Environment> env = self->new_shadow_environment();
+            MutexLock shadow_lock(self->shadow_mutex_);
+            self->shadow_environments_.push_back({Thread::UNASSIGNED_ID, env, 0});
+            ++self->shadow_stats_.prewarmed;
+        }
+        if (self->shadow_prewarm_interrupted_.is_set())
+        {
+            break;
         }
     }
-    jsb_checkf(found, "not a registered shadow environment");
-    if (should_dispose) p_env->dispose();
 }
@@ -2,8 +2,10 @@
 #define GODOTJS_SCRIPT_LANGUAGE_H
 
 #include "../bridge/jsb_bridge.h"
+#include "../internal/jsb_global_class_index.h"
 
 #include "core/object/script_language.h"
+#include "core/os/semaphore.h"
 
 class GodotJSScript;
 class GodotJSMonitor;
@@ -66,7 +68,6 @@ private:
         int rc = 0;
     };
 
-#if JSB_DEBUG
     struct ScriptCallProfileInfo
     {
         uint64_t total_time = 0;
@@ -88,7 +89,6 @@ private:
         bool enabled = false;
         HashMap<StringName, ScriptClassProfileInfo> classes;
     };
-#endif
 
     static GodotJSScriptLanguage* singleton_;
 
@@ -99,23 +99,33 @@ private:
     uint64_t last_ticks_ = 0;
     std::shared_ptr<jsb::Environment> environment_;
 
-    Mutex shadow_mutex_;
+    mutable Mutex shadow_mutex_;
     std::vector<ShadowEnvironment> shadow_environments_;
+    jsb::ShadowEnvironmentStats shadow_stats_ = {};
+
+    // released shadow environments which have run user code, disposed by the prewarm thread
+    std::vector<std::shared_ptr<jsb::Environment>> retired_shadow_environments_;
+
+    // idle shadow environments are kept for reusing (up to `shadow_pool_size_`),
+    // and `shadow_prewarm_num_` of them are initialized in background ahead of demand.
+    int shadow_pool_size_ = JSB_MAX_CACHED_SHADOW_ENVIRONMENTS;
+    int shadow_prewarm_num_ = 0;
+    Thread shadow_prewarm_thread_;
+    Semaphore shadow_prewarm_semaphore_;
+    SafeFlag shadow_prewarm_interrupted_ = SafeFlag(false);
 
 #if JSB_DEBUG
     GodotJSMonitor* monitor_ = nullptr;
-    ScriptCallProfileInfoMap profile_info_map_;
 #endif
 
-    // [TS] matches 'export default class ClassName extends BaseName {'
-    Ref<RegEx> ts_class_name_matcher_;
-    Ref<RegEx> ts_class_name_tool_matcher_;
-
-    // [JS] export & declare in two lines, matches 'class ClassName extends BaseName' + 'exports.default = ClassName'
-    Ref<RegEx> js_class_name_matcher2_;
+    // aggregated from the events collected from CallProfiler for the engine profiler
+    ScriptCallProfileInfoMap profile_info_map_;
+    std::vector<jsb::internal::CallProfiler::Event> profile_events_;
 
-    // [JS] export & declare in a single line, matches 'exports.default = class ClassName extends BaseName'
-    Ref<RegEx> js_class_name_matcher1_;
+    // global classes declared in script files (see `get_global_class_name`),
+    // persisted in the project data dir and saved periodically in the editor.
+    mutable jsb::internal::GlobalClassIndex global_class_index_;
+    uint64_t global_class_index_saved_msec_ = 0;
 
 public:
     jsb_force_inline static GodotJSScriptLanguage* get_singleton() { return singleton_; }
@@ -133,7 +143,8 @@ public:
 
     void scan_external_changes();
 
-    void add_script_call_profile_info(const String& p_path, const StringName& p_class, const StringName& p_method, uint64_t p_time);
+    // [thread safe]
+    void get_shadow_environment_stats(jsb::ShadowEnvironmentStats& r_stats) const;
 
     template<size_t N>
     jsb::JSValueMove eval_source(const char (&p_code)[N], Error& r_err)
@@ -248,8 +259,18 @@ public:
 #pragma endregion
 
 private:
+    // [main thread] collect the recorded call events and update the profile info
+    void collect_profile_events();
+
+    // acquire a shadow environment from the pool (or create a new one if not available)
     std::shared_ptr<jsb::Environment> create_shadow_environment();
+
+    // release a shadow environment, it's recycled for reusing unless the pool is full or it has run any user code
     void destroy_shadow_environment(const std::shared_ptr<jsb::Environment>& p_env);
+
+    std::shared_ptr<jsb::Environment> new_shadow_environment() const;
+    void request_shadow_prewarm();
+    static void _shadow_prewarm_run(void* p_data);
 };
 
 #endif